@@ -0,0 +1,347 @@
+////////////////////////////////////////////////////////////
+// 
+// This is an added file for this modified version of SFML 2.5.1
+// Modified by Justyn Durnford
+// Last modified on 2026-10-17
+// 
+// SFML - Simple and Fast Multimedia Library
+// Copyright (X) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_RENDERQUEUE_HPP
+#define SFML_RENDERQUEUE_HPP
+
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/SpriteBatch.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+namespace sf
+{
+	// Records draws instead of making them, and makes them all at once
+	// when flushed, ordered so that the target changes state as seldom
+	// as possible.
+	//
+	// In Sorted mode the draws are stable sorted by depth, then by shader,
+	// texture and blend mode, so draws with a lower depth still end up
+	// underneath, and draws that share a depth and states keep their order.
+	// Draws that share a depth but not their states may swap, so draws that
+	// overlap and must stay in order need different depths. In Submission
+	// mode the draws are kept in the order they were made.
+	//
+	// Either way, consecutive draws of Points, Lines, Triangles or Quads
+	// with the same states are merged into one call, with their transforms
+	// applied on the CPU. Strips and fans are drawn one call each.
+	//
+	// Vertices are copied as they are recorded, so they may be changed or
+	// freed before the flush. Textures and shaders may not.
+	class RenderQueue
+	{
+		public:
+
+		enum SortMode
+		{
+			Submission,
+			Sorted
+		};
+
+		// Numbers of times consecutive draws used a different state.
+		struct StateChanges
+		{
+			std::size_t texture = 0u;
+			std::size_t shader = 0u;
+			std::size_t blendMode = 0u;
+
+			// 
+			std::size_t total() const
+			{
+				return texture + shader + blendMode;
+			}
+		};
+
+		// Counts over every flush since the RenderQueue was created
+		// or resetStatistics() was last called.
+		struct Statistics
+		{
+			std::size_t commands = 0u;
+			std::size_t vertices = 0u;
+			std::size_t drawCalls = 0u;
+
+			// State changes the draws would have made in the order they were recorded.
+			StateChanges submitted;
+
+			// State changes the flushed draws made.
+			StateChanges flushed;
+
+			// 
+			std::size_t avoided() const
+			{
+				return submitted.total() - flushed.total();
+			}
+		};
+
+		private:
+
+		struct Command
+		{
+			PrimitiveType type;
+			RenderStates states;
+			float depth;
+			std::size_t first;
+			std::size_t count;
+		};
+
+		std::vector<Vertex> vertices_;
+		std::vector<Command> commands_;
+		std::vector<std::size_t> order_;
+		std::vector<Vertex> merged_;
+		SortMode mode_;
+		Statistics statistics_;
+
+		// Returns the fields of mode packed into one integer, to order by.
+		static std::uint32_t blendKey(const BlendMode& mode)
+		{
+			return (static_cast<std::uint32_t>(mode.colorSrcFactor) << 20) | (static_cast<std::uint32_t>(mode.colorDstFactor) << 16)
+			     | (static_cast<std::uint32_t>(mode.colorEquation) << 12) | (static_cast<std::uint32_t>(mode.alphaSrcFactor) << 8)
+			     | (static_cast<std::uint32_t>(mode.alphaDstFactor) << 4) | static_cast<std::uint32_t>(mode.alphaEquation);
+		}
+
+		// Returns true if A is drawn before B in Sorted mode.
+		// NaN depths compare equal to each other and greater than any
+		// other depth, so that the order stays a strict weak ordering.
+		static bool before(const Command& A, const Command& B)
+		{
+			bool a_nan = std::isnan(A.depth);
+			bool b_nan = std::isnan(B.depth);
+
+			if (a_nan != b_nan)
+				return b_nan;
+			if (!a_nan && A.depth != B.depth)
+				return A.depth < B.depth;
+			if (A.states.shader != B.states.shader)
+				return std::less<const Shader*>()(A.states.shader, B.states.shader);
+			if (A.states.texture != B.states.texture)
+				return std::less<const Texture*>()(A.states.texture, B.states.texture);
+
+			return blendKey(A.states.blendMode) < blendKey(B.states.blendMode);
+		}
+
+		// Returns true if draws of type can be concatenated into one.
+		static bool mergeable(PrimitiveType type)
+		{
+			return type == Points || type == Lines || type == Triangles || type == Quads;
+		}
+
+		// Returns true if A and B can be drawn with one call.
+		static bool compatible(const Command& A, const Command& B)
+		{
+			return A.type == B.type && mergeable(A.type) && A.states.shader == B.states.shader
+			    && A.states.texture == B.states.texture && A.states.blendMode == B.states.blendMode;
+		}
+
+		// Counts the states that differ between previous and next.
+		static void count(StateChanges& changes, const RenderStates* previous, const RenderStates& next)
+		{
+			if (previous == nullptr)
+				return;
+
+			changes.texture += previous->texture != next.texture;
+			changes.shader += previous->shader != next.shader;
+			changes.blendMode += previous->blendMode != next.blendMode;
+		}
+
+		// Appends the vertices of command to merged_, transformed on the CPU.
+		void appendTransformed(const Command& command)
+		{
+			const float* m = command.states.transform.getMatrix();
+
+			for (std::size_t i = command.first; i < command.first + command.count; ++i)
+			{
+				Vertex vertex = vertices_[i];
+				float x = vertex.position.x;
+				float y = vertex.position.y;
+
+				vertex.position.x = m[0] * x + m[4] * y + m[12];
+				vertex.position.y = m[1] * x + m[5] * y + m[13];
+				merged_.push_back(vertex);
+			}
+		}
+
+		public:
+
+		// 
+		RenderQueue(SortMode mode = Sorted)
+			: mode_(mode) {}
+
+		// 
+		void setSortMode(SortMode mode)
+		{
+			mode_ = mode;
+		}
+
+		// 
+		SortMode sortMode() const
+		{
+			return mode_;
+		}
+
+		// Records a draw of count vertices as RenderTarget::draw() takes them.
+		// Draws with a lower depth are flushed first, and draws with a NaN depth last.
+		void draw(const Vertex* vertices, std::size_t count, PrimitiveType type,
+			const RenderStates& states = RenderStates::Default, float depth = 0.f)
+		{
+			if (vertices == nullptr || count == 0u)
+				return;
+
+			commands_.push_back({ type, states, depth, vertices_.size(), count });
+			vertices_.insert(vertices_.end(), vertices, vertices + count);
+		}
+
+		// Records a draw of array.
+		void draw(const VertexArray& array, const RenderStates& states = RenderStates::Default, float depth = 0.f)
+		{
+			if (array.getVertexCount() > 0u)
+				draw(&array[0], array.getVertexCount(), array.getPrimitiveType(), states, depth);
+		}
+
+		// Records a draw of sprite, as a quad that can be merged with the
+		// quads of other sprites. Sprites without a texture are skipped.
+		void draw(const Sprite& sprite, RenderStates states = RenderStates::Default, float depth = 0.f)
+		{
+			if (sprite.getTexture() == nullptr)
+				return;
+
+			Vertex quad[4];
+			priv::sprite_quad(sprite, quad);
+
+			states.transform *= sprite.getTransform();
+			states.texture = sprite.getTexture();
+			draw(quad, 4u, Quads, states, depth);
+		}
+
+		// Makes every recorded draw on target, then forgets them.
+		//
+		// target is anything with a draw(const Vertex*, std::size_t,
+		// PrimitiveType, const RenderStates&) member, so a RenderTarget,
+		// or a stand-in that records the calls where there is no GPU.
+		template <typename Target>
+		void flush(Target& target)
+		{
+			std::size_t n = commands_.size();
+
+			order_.resize(n);
+			std::iota(order_.begin(), order_.end(), std::size_t(0));
+
+			if (mode_ == Sorted)
+			{
+				std::stable_sort(order_.begin(), order_.end(), [this](std::size_t a, std::size_t b)
+				{
+					return before(commands_[a], commands_[b]);
+				});
+			}
+
+			const RenderStates* previous = nullptr;
+
+			for (const Command& command : commands_)
+			{
+				count(statistics_.submitted, previous, command.states);
+				previous = &command.states;
+			}
+
+			previous = nullptr;
+
+			for (std::size_t i = 0; i < n;)
+			{
+				const Command& command = commands_[order_[i]];
+				std::size_t j = i + 1u;
+
+				while (j < n && compatible(command, commands_[order_[j]]))
+					++j;
+
+				count(statistics_.flushed, previous, command.states);
+				previous = &command.states;
+
+				if (j == i + 1u)
+					target.draw(&vertices_[command.first], command.count, command.type, command.states);
+				else
+				{
+					merged_.clear();
+
+					for (std::size_t k = i; k < j; ++k)
+						appendTransformed(commands_[order_[k]]);
+
+					RenderStates states = command.states;
+					states.transform = Transform();
+					target.draw(merged_.data(), merged_.size(), command.type, states);
+				}
+
+				++statistics_.drawCalls;
+				i = j;
+			}
+
+			statistics_.commands += n;
+			statistics_.vertices += vertices_.size();
+			clear();
+		}
+
+		// Forgets every recorded draw without making it.
+		void clear()
+		{
+			vertices_.clear();
+			commands_.clear();
+		}
+
+		// Returns the number of recorded draws waiting for a flush.
+		std::size_t commandCount() const
+		{
+			return commands_.size();
+		}
+
+		// 
+		const Statistics& statistics() const
+		{
+			return statistics_;
+		}
+
+		// 
+		void resetStatistics()
+		{
+			statistics_ = Statistics();
+		}
+	};
+}
+
+#endif // SFML_RENDERQUEUE_HPP
\ No newline at end of file
@@ -0,0 +1,242 @@
+////////////////////////////////////////////////////////////
+// 
+// This is an added file for this modified version of SFML 2.5.1
+// Modified by Justyn Durnford
+// Last modified on 2026-10-17
+// 
+// SFML - Simple and Fast Multimedia Library
+// Copyright (X) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_SPRITEBATCH_HPP
+#define SFML_SPRITEBATCH_HPP
+
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+namespace sf
+{
+	namespace priv
+	{
+		// Writes the quad sprite is drawn as to quad, in the sprite's own
+		// coordinates: top-left, top-right, bottom-right, bottom-left.
+		inline void sprite_quad(const Sprite& sprite, Vertex* quad)
+		{
+			const IntRect& rect = sprite.getTextureRect();
+			const Color& color = sprite.getColor();
+			float width = static_cast<float>(std::abs(rect.width));
+			float height = static_cast<float>(std::abs(rect.height));
+			float left = static_cast<float>(rect.left);
+			float top = static_cast<float>(rect.top);
+			float right = left + static_cast<float>(rect.width);
+			float bottom = top + static_cast<float>(rect.height);
+
+			quad[0] = Vertex(Vector2f(0.f, 0.f), color, Vector2f(left, top));
+			quad[1] = Vertex(Vector2f(width, 0.f), color, Vector2f(right, top));
+			quad[2] = Vertex(Vector2f(width, height), color, Vector2f(right, bottom));
+			quad[3] = Vertex(Vector2f(0.f, height), color, Vector2f(left, bottom));
+		}
+	}
+
+	// Collects sprites into one contiguous array of quads, and draws them
+	// with one RenderTarget::draw() call per run of consecutive sprites that
+	// share a texture and blend mode, instead of one call per sprite.
+	//
+	// Every sprite's transform is applied on the CPU as it is added, so a
+	// run of sprites with different positions, rotations and scales still
+	// needs only the one call. Sprites are drawn in the order they were
+	// added, so sprites with different textures that are added interleaved
+	// break the runs up; add them grouped by texture where the order does
+	// not matter.
+	//
+	// The RenderStates passed to draw() apply to the whole batch, except
+	// for their texture and blend mode, which come from each run.
+	class SpriteBatch : public Drawable
+	{
+		// Consecutive quads drawn with one call.
+		struct Run
+		{
+			const Texture* texture;
+			BlendMode blendMode;
+			std::size_t first;
+			std::size_t count;
+		};
+
+		std::vector<Vertex> vertices_;
+		std::vector<Run> runs_;
+		mutable std::size_t drawCalls_;
+
+		// Starts a new run unless the last one has the same texture and blend mode.
+		void extend(const Texture* texture, const BlendMode& blendMode)
+		{
+			if (runs_.empty() || runs_.back().texture != texture || runs_.back().blendMode != blendMode)
+				runs_.push_back({ texture, blendMode, vertices_.size(), 0u });
+
+			runs_.back().count += 4u;
+		}
+
+		// Appends the quad whose corners are at p, p + u, p + u + v and p + v,
+		// textured with rect.
+		void append(const Vector2f& p, const Vector2f& u, const Vector2f& v, const IntRect& rect, const Color& color)
+		{
+			float left = static_cast<float>(rect.left);
+			float top = static_cast<float>(rect.top);
+			float right = left + static_cast<float>(rect.width);
+			float bottom = top + static_cast<float>(rect.height);
+
+			vertices_.push_back(Vertex(p, color, Vector2f(left, top)));
+			vertices_.push_back(Vertex(Vector2f(p.x + u.x, p.y + u.y), color, Vector2f(right, top)));
+			vertices_.push_back(Vertex(Vector2f(p.x + u.x + v.x, p.y + u.y + v.y), color, Vector2f(right, bottom)));
+			vertices_.push_back(Vertex(Vector2f(p.x + v.x, p.y + v.y), color, Vector2f(left, bottom)));
+		}
+
+		// Draws every run.
+		virtual void draw(RenderTarget& target, RenderStates states) const
+		{
+			drawTo(target, states);
+		}
+
+		public:
+
+		// 
+		SpriteBatch()
+			: drawCalls_(0u) {}
+
+		// Removes every sprite. The draw call count is kept.
+		void clear()
+		{
+			vertices_.clear();
+			runs_.clear();
+		}
+
+		// Reserves room for count sprites.
+		void reserve(std::size_t count)
+		{
+			vertices_.reserve(count * 4u);
+		}
+
+		// Adds sprite as it would be drawn by RenderTarget::draw(sprite),
+		// blended with blendMode. Sprites without a texture are skipped,
+		// as Sprite::draw() skips them.
+		void add(const Sprite& sprite, const BlendMode& blendMode = BlendAlpha)
+		{
+			if (sprite.getTexture() == nullptr)
+				return;
+
+			add(*sprite.getTexture(), sprite.getTextureRect(), sprite.getTransform(), sprite.getColor(), blendMode);
+		}
+
+		// Adds rect of texture, transformed by transform.
+		void add(const Texture& texture, const IntRect& rect, const Transform& transform,
+			const Color& color = Color::White, const BlendMode& blendMode = BlendAlpha)
+		{
+			const float* m = transform.getMatrix();
+			float width = static_cast<float>(std::abs(rect.width));
+			float height = static_cast<float>(std::abs(rect.height));
+
+			// The transform is affine, so the corners follow from the
+			// transformed origin and the transformed edges.
+			Vector2f p(m[12], m[13]);
+			Vector2f u(m[0] * width, m[1] * width);
+			Vector2f v(m[4] * height, m[5] * height);
+
+			extend(&texture, blendMode);
+			append(p, u, v, rect, color);
+		}
+
+		// Adds rect of texture with its top-left corner at position,
+		// neither rotated nor scaled.
+		void add(const Texture& texture, const IntRect& rect, const Vector2f& position,
+			const Color& color = Color::White, const BlendMode& blendMode = BlendAlpha)
+		{
+			Vector2f u(static_cast<float>(std::abs(rect.width)), 0.f);
+			Vector2f v(0.f, static_cast<float>(std::abs(rect.height)));
+
+			extend(&texture, blendMode);
+			append(position, u, v, rect, color);
+		}
+
+		// Draws every run on target, which is anything with a draw(const
+		// Vertex*, std::size_t, PrimitiveType, const RenderStates&) member,
+		// such as a RenderTarget or a RecordingTarget.
+		template <typename Target>
+		void drawTo(Target& target, RenderStates states = RenderStates::Default) const
+		{
+			for (const Run& run : runs_)
+			{
+				states.texture = run.texture;
+				states.blendMode = run.blendMode;
+				target.draw(&vertices_[run.first], run.count, Quads, states);
+			}
+
+			drawCalls_ += runs_.size();
+		}
+
+		// Returns the number of sprites in the batch.
+		std::size_t spriteCount() const
+		{
+			return vertices_.size() / 4u;
+		}
+
+		// Returns the number of draw calls drawing the batch takes:
+		// one for every run of sprites that share a texture and blend mode.
+		std::size_t batchCount() const
+		{
+			return runs_.size();
+		}
+
+		// Returns the number of draw calls made by every draw of the batch
+		// since it was created or resetDrawCalls() was last called.
+		std::size_t drawCalls() const
+		{
+			return drawCalls_;
+		}
+
+		// 
+		void resetDrawCalls()
+		{
+			drawCalls_ = 0u;
+		}
+
+		// Returns the vertices of every sprite, four per sprite,
+		// in the order they are drawn.
+		const std::vector<Vertex>& vertices() const
+		{
+			return vertices_;
+		}
+	};
+}
+
+#endif // SFML_SPRITEBATCH_HPP
\ No newline at end of file
@@ -36,6 +36,7 @@
 #include <SFML/Config.hpp>
 #include <SFML/System/Arithmetic.hpp>
 #include <SFML/System/Clock.hpp>
+#include <SFML/System/DynamicMatrix.hpp>
 #include <SFML/System/Err.hpp>
 #include <SFML/System/FileInputStream.hpp>
 #include <SFML/System/Fraction.hpp>
@@ -45,6 +46,7 @@
 #include <SFML/System/Matrix.hpp>
 #include <SFML/System/Mutex.hpp>
 #include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Parallel.hpp>
 #include <SFML/System/Point2.hpp>
 #include <SFML/System/Point3.hpp>
 #include <SFML/System/Sleep.hpp>
@@ -53,10 +55,12 @@
 #include <SFML/System/Thread.hpp>
 #include <SFML/System/ThreadLocal.hpp>
 #include <SFML/System/ThreadLocalPtr.hpp>
+#include <SFML/System/ThreadPool.hpp>
 #include <SFML/System/Time.hpp>
 #include <SFML/System/Utf.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <SFML/System/Vector3.hpp>
+#include <SFML/System/VectorMath.hpp>
 
 #endif // SFML_SYSTEM_HPP
 
@@ -0,0 +1,528 @@
+////////////////////////////////////////////////////////////
+// 
+// This is an added file for this modified version of SFML 2.5.1
+// Modified by Justyn Durnford
+// Last modified on 2026-10-17
+// 
+// SFML - Simple and Fast Multimedia Library
+// Copyright (X) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_CHUNKEDTABLE_HPP
+#define SFML_CHUNKEDTABLE_HPP
+
+#include <SFML/System/MappedFile.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace sf
+{
+	// A view of one populated chunk of a ChunkedTable: the cells in
+	// [x, x + cols) by [y, y + rows), clipped to the edges of the table.
+	template <typename T> struct TableChunk
+	{
+		std::size_t x;
+		std::size_t y;
+		std::size_t cols;
+		std::size_t rows;
+		std::size_t stride;
+		T* data;
+
+		// Returns the cell at (x + local_x, y + local_y).
+		T& operator () (std::size_t local_x, std::size_t local_y) const
+		{
+			return data[local_y * stride + local_x];
+		}
+
+		// Returns a view of row y + local_y within the chunk.
+		std::span<T> row(std::size_t local_y) const
+		{
+			return std::span<T>(data + local_y * stride, cols);
+		}
+	};
+
+	// A rectangular table of rows x cols cells, split into square chunks of
+	// ChunkSize x ChunkSize cells that are only allocated once a cell within
+	// them is written. Every cell of an unallocated chunk reads as the empty
+	// value given on construction, so a mostly empty world of 100000 x 100000
+	// tiles costs a pointer per chunk plus the chunks actually in use.
+	//
+	// Elements are indexed (x, y) like Table, x being the column and y the row.
+	// Reading through a const ChunkedTable never allocates; operator() on a
+	// non-const one does, since it returns a reference that may be written.
+	//
+	// saveToFile() writes the populated chunks, and openFromFile() maps such a
+	// file into memory rather than reading it, so chunks are only read from
+	// disk when first touched. Written chunks are copied out of the file first;
+	// the file itself never changes until it is saved over.
+	template <std::semiregular T, std::size_t ChunkSize = 64u> class ChunkedTable
+	{
+		static_assert(ChunkSize > 0u, "ChunkSize must not be 0");
+
+		static constexpr std::size_t chunk_area = ChunkSize * ChunkSize;
+		static constexpr std::uint32_t file_version = 1u;
+
+		// The layout of the start of a saved file. It is followed by the
+		// offset of every chunk from the start of the file, 0 for one that
+		// is not populated, then the empty value, then the chunks, each
+		// aligned to 64 bytes. Everything is in the byte order of the
+		// machine that saved it.
+		struct FileHeader
+		{
+			char magic[4];
+			std::uint32_t version;
+			std::uint64_t rows;
+			std::uint64_t cols;
+			std::uint64_t chunkSize;
+			std::uint64_t elementSize;
+		};
+
+		std::size_t rows_;
+		std::size_t cols_;
+		std::size_t chunkCols_;
+		T empty_;
+		std::vector<std::unique_ptr<T[]>> chunks_;
+		std::vector<const T*> mapped_;
+		std::size_t populated_;
+		MappedFile file_;
+		std::string filename_;
+
+		// Returns in count the number of chunks covering a rows x cols
+		// table, or returns false if that number does not fit in a size_t.
+		static bool chunkCount(std::uint64_t rows, std::uint64_t cols, std::size_t& count)
+		{
+			std::uint64_t chunk_rows = rows / ChunkSize + (rows % ChunkSize != 0u ? 1u : 0u);
+			std::uint64_t chunk_cols = cols / ChunkSize + (cols % ChunkSize != 0u ? 1u : 0u);
+			constexpr std::uint64_t max_count = std::numeric_limits<std::size_t>::max();
+
+			if (rows > max_count || cols > max_count || (chunk_rows != 0u && chunk_cols > max_count / chunk_rows))
+				return false;
+
+			count = static_cast<std::size_t>(chunk_rows * chunk_cols);
+			return true;
+		}
+
+		//
+		void checkBounds(std::size_t x, std::size_t y) const
+		{
+			if (y >= rows_)
+				throw std::out_of_range("Invalid row index");
+			if (x >= cols_)
+				throw std::out_of_range("Invalid column index");
+		}
+
+		//
+		std::size_t chunkIndex(std::size_t x, std::size_t y) const
+		{
+			return (y / ChunkSize) * chunkCols_ + x / ChunkSize;
+		}
+
+		//
+		static std::size_t localIndex(std::size_t x, std::size_t y)
+		{
+			return (y % ChunkSize) * ChunkSize + x % ChunkSize;
+		}
+
+		// Returns the cells of chunk i, or null if it is not populated.
+		const T* find(std::size_t i) const
+		{
+			if (chunks_[i])
+				return chunks_[i].get();
+
+			return mapped_.empty() ? nullptr : mapped_[i];
+		}
+
+		// Returns the cells of chunk i, allocating it if it is not
+		// populated and copying it out of the file if it is mapped.
+		T* fetch(std::size_t i)
+		{
+			if (!chunks_[i])
+			{
+				const T* source = mapped_.empty() ? nullptr : mapped_[i];
+				chunks_[i] = std::make_unique<T[]>(chunk_area);
+
+				if (source != nullptr)
+					std::copy(source, source + chunk_area, chunks_[i].get());
+				else
+				{
+					std::fill(chunks_[i].get(), chunks_[i].get() + chunk_area, empty_);
+					++populated_;
+				}
+			}
+
+			return chunks_[i].get();
+		}
+
+		//
+		template <typename U>
+		TableChunk<U> makeChunk(std::size_t i, U* data) const
+		{
+			std::size_t x = (i % chunkCols_) * ChunkSize;
+			std::size_t y = (i / chunkCols_) * ChunkSize;
+
+			return TableChunk<U>{ x, y, std::min(ChunkSize, cols_ - x), std::min(ChunkSize, rows_ - y), ChunkSize, data };
+		}
+
+		//
+		static std::size_t align64(std::size_t offset)
+		{
+			return (offset + 63u) & ~std::size_t(63u);
+		}
+
+		public:
+
+		using value_type = T;
+		using size_type = std::size_t;
+
+		//
+		static constexpr std::size_t chunk_size = ChunkSize;
+
+		//
+		ChunkedTable()
+			: ChunkedTable(0u, 0u) {}
+
+		// Creates a ChunkedTable with every cell reading as empty.
+		ChunkedTable(std::size_t rows, std::size_t cols, const T& empty = T())
+		{
+			resize(rows, cols, empty);
+		}
+
+		ChunkedTable(const ChunkedTable& other) = delete;
+		ChunkedTable& operator = (const ChunkedTable& other) = delete;
+
+		//
+		ChunkedTable(ChunkedTable&& other) = default;
+
+		//
+		ChunkedTable& operator = (ChunkedTable&& other) = default;
+
+		//
+		~ChunkedTable() = default;
+
+		// Frees every chunk and closes any mapped file, leaving
+		// a rows x cols table with every cell reading as empty.
+		// Throws std::length_error, leaving the table as it was,
+		// if the number of chunks does not fit in a size_t.
+		void resize(std::size_t rows, std::size_t cols, const T& empty = T())
+		{
+			std::size_t chunk_count;
+
+			if (!chunkCount(rows, cols, chunk_count))
+				throw std::length_error("ChunkedTable dimensions are too large");
+
+			std::vector<std::unique_ptr<T[]>> chunks(chunk_count);
+
+			rows_ = rows;
+			cols_ = cols;
+			chunkCols_ = cols / ChunkSize + (cols % ChunkSize != 0u ? 1u : 0u);
+			empty_ = empty;
+			populated_ = 0u;
+
+			chunks_ = std::move(chunks);
+			mapped_.clear();
+			file_.close();
+			filename_.clear();
+		}
+
+		//
+		std::size_t rowCount() const
+		{
+			return rows_;
+		}
+
+		//
+		std::size_t colCount() const
+		{
+			return cols_;
+		}
+
+		// Returns the value every cell of an unpopulated chunk reads as.
+		const T& emptyValue() const
+		{
+			return empty_;
+		}
+
+		// Returns the number of chunks across and down the table.
+		std::size_t chunkCount() const
+		{
+			return chunks_.size();
+		}
+
+		// Returns the number of chunks that are populated,
+		// either in memory or in the mapped file.
+		std::size_t populatedCount() const
+		{
+			return populated_;
+		}
+
+		// Returns the bytes held by chunks allocated in memory,
+		// not counting those only read from the mapped file.
+		std::size_t memoryUsage() const
+		{
+			std::size_t allocated = 0u;
+
+			for (const auto& chunk : chunks_)
+			{
+				if (chunk)
+					++allocated;
+			}
+
+			return allocated * chunk_area * sizeof(T);
+		}
+
+		// Returns true if the chunk holding (x, y) is populated.
+		bool isPopulated(std::size_t x, std::size_t y) const
+		{
+			checkBounds(x, y);
+			return find(chunkIndex(x, y)) != nullptr;
+		}
+
+		// Frees the chunk holding (x, y), so that all of its cells read as
+		// empty again. A chunk in the mapped file is dropped as well.
+		void clearChunk(std::size_t x, std::size_t y)
+		{
+			checkBounds(x, y);
+			std::size_t i = chunkIndex(x, y);
+
+			if (find(i) == nullptr)
+				return;
+
+			chunks_[i].reset();
+
+			if (!mapped_.empty())
+				mapped_[i] = nullptr;
+
+			--populated_;
+		}
+
+		// Returns a view of every populated chunk, in row order of chunks.
+		// Chunks only in the mapped file are copied into memory first.
+		std::vector<TableChunk<T>> chunks()
+		{
+			std::vector<TableChunk<T>> views;
+			views.reserve(populated_);
+
+			for (std::size_t i = 0; i < chunks_.size(); ++i)
+			{
+				if (find(i) != nullptr)
+					views.push_back(makeChunk(i, fetch(i)));
+			}
+
+			return views;
+		}
+
+		// Returns a view of every populated chunk, in row order of chunks.
+		std::vector<TableChunk<const T>> chunks() const
+		{
+			std::vector<TableChunk<const T>> views;
+			views.reserve(populated_);
+
+			for (std::size_t i = 0; i < chunks_.size(); ++i)
+			{
+				if (const T* data = find(i))
+					views.push_back(makeChunk(i, data));
+			}
+
+			return views;
+		}
+
+		//
+		T& at(std::size_t x, std::size_t y)
+		{
+			checkBounds(x, y);
+			return fetch(chunkIndex(x, y))[localIndex(x, y)];
+		}
+
+		//
+		const T& at(std::size_t x, std::size_t y) const
+		{
+			checkBounds(x, y);
+			return (*this)(x, y);
+		}
+
+		// Sets the cell at (x, y). Setting a cell of an unpopulated
+		// chunk to the empty value does not populate the chunk.
+		void set(std::size_t x, std::size_t y, const T& value)
+		{
+			checkBounds(x, y);
+			std::size_t i = chunkIndex(x, y);
+
+			if constexpr (std::equality_comparable<T>)
+			{
+				if (find(i) == nullptr && value == empty_)
+					return;
+			}
+
+			fetch(i)[localIndex(x, y)] = value;
+		}
+
+		// Populates the chunk holding (x, y) if it is not already.
+		T& operator () (std::size_t x, std::size_t y)
+		{
+			return fetch(chunkIndex(x, y))[localIndex(x, y)];
+		}
+
+		//
+		const T& operator () (std::size_t x, std::size_t y) const
+		{
+			const T* data = find(chunkIndex(x, y));
+			return data == nullptr ? empty_ : data[localIndex(x, y)];
+		}
+
+		// Writes the size, the empty value and every populated chunk to
+		// filename. Saving over the file the table is mapped from reads all
+		// of its chunks into memory first. Returns false if writing fails.
+		bool saveToFile(const std::string& filename) requires std::is_trivially_copyable_v<T>
+		{
+			static_assert(alignof(T) <= 64u, "Elements must fit the 64 byte alignment of saved chunks");
+
+			std::error_code error;
+
+			if (file_.isOpen() && std::filesystem::equivalent(filename, filename_, error))
+			{
+				for (std::size_t i = 0; i < chunks_.size(); ++i)
+				{
+					if (mapped_[i] != nullptr)
+						fetch(i);
+				}
+
+				mapped_.clear();
+				file_.close();
+				filename_.clear();
+			}
+
+			std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+
+			if (!file)
+				return false;
+
+			FileHeader header = { { 'S', 'F', 'C', 'T' }, file_version, rows_, cols_, ChunkSize, sizeof(T) };
+			std::vector<std::uint64_t> offsets(chunks_.size(), 0u);
+
+			std::size_t offset = align64(sizeof(header) + offsets.size() * sizeof(std::uint64_t) + sizeof(T));
+
+			for (std::size_t i = 0; i < chunks_.size(); ++i)
+			{
+				if (find(i) != nullptr)
+				{
+					offsets[i] = offset;
+					offset += align64(chunk_area * sizeof(T));
+				}
+			}
+
+			file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			file.write(reinterpret_cast<const char*>(offsets.data()), static_cast<std::streamsize>(offsets.size() * sizeof(std::uint64_t)));
+			file.write(reinterpret_cast<const char*>(&empty_), sizeof(T));
+
+			static const char padding[64] = {};
+			std::size_t written = sizeof(header) + offsets.size() * sizeof(std::uint64_t) + sizeof(T);
+
+			for (std::size_t i = 0; i < chunks_.size(); ++i)
+			{
+				if (offsets[i] == 0u)
+					continue;
+
+				file.write(padding, static_cast<std::streamsize>(offsets[i] - written));
+				file.write(reinterpret_cast<const char*>(find(i)), static_cast<std::streamsize>(chunk_area * sizeof(T)));
+				written = offsets[i] + chunk_area * sizeof(T);
+			}
+
+			return static_cast<bool>(file.flush());
+		}
+
+		// Replaces the table with the one saved in filename, mapping the
+		// file rather than reading it. Returns false, leaving the table as
+		// it was, if the file cannot be mapped or was not saved by a
+		// ChunkedTable of the same element size and ChunkSize.
+		bool openFromFile(const std::string& filename) requires std::is_trivially_copyable_v<T>
+		{
+			MappedFile file;
+
+			if (!file.open(filename) || file.size() < sizeof(FileHeader))
+				return false;
+
+			FileHeader header;
+			std::memcpy(&header, file.data(), sizeof(header));
+
+			if (std::memcmp(header.magic, "SFCT", 4u) != 0 || header.version != file_version
+				|| header.chunkSize != ChunkSize || header.elementSize != sizeof(T))
+				return false;
+
+			// The offset table alone must fit in the file, which also
+			// keeps table_end from wrapping for corrupt dimensions.
+			std::size_t chunk_count;
+
+			if (!chunkCount(header.rows, header.cols, chunk_count)
+				|| chunk_count > (file.size() - sizeof(header)) / sizeof(std::uint64_t))
+				return false;
+
+			std::size_t table_end = sizeof(header) + chunk_count * sizeof(std::uint64_t);
+
+			if (file.size() - table_end < sizeof(T))
+				return false;
+
+			std::vector<const T*> mapped(chunk_count, nullptr);
+			std::size_t populated = 0u;
+
+			for (std::size_t i = 0; i < chunk_count; ++i)
+			{
+				std::uint64_t offset;
+				std::memcpy(&offset, file.data() + sizeof(header) + i * sizeof(offset), sizeof(offset));
+
+				if (offset == 0u)
+					continue;
+
+				if (offset % 64u != 0u || offset < table_end || offset > file.size() || file.size() - offset < chunk_area * sizeof(T))
+					return false;
+
+				mapped[i] = reinterpret_cast<const T*>(file.data() + offset);
+				++populated;
+			}
+
+			T empty;
+			std::memcpy(&empty, file.data() + table_end, sizeof(T));
+
+			resize(static_cast<std::size_t>(header.rows), static_cast<std::size_t>(header.cols), empty);
+			mapped_ = std::move(mapped);
+			populated_ = populated;
+			file_ = std::move(file);
+			filename_ = filename;
+
+			return true;
+		}
+	};
+}
+
+#endif // SFML_CHUNKEDTABLE_HPP
\ No newline at end of file
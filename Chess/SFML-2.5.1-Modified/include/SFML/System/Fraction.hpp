@@ -2,7 +2,7 @@
 // 
 // This is an added file for this modified version of SFML 2.5.1
 // Modified by Justyn Durnford
-// Last modified on 2021-05-15
+// Last modified on 2026-10-17
 // 
 // SFML - Simple and Fast Multimedia Library
 // Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
@@ -29,17 +29,362 @@
 #ifndef SFML_FRACTION_HPP
 #define SFML_FRACTION_HPP
 
+#include <bit>
 #include <compare>
 #include <concepts>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 namespace sf
 {
-	// This class provides an "exact" representation of the quotient of two 
-	// integers by storing them and allowing fraction arithmetic with them. 
+	namespace priv
+	{
+		// An unsigned integer of 128 bits, for compilers without one built in.
+		// Only does what Fraction needs of it.
+		struct UInt128
+		{
+			std::uint64_t high;
+			std::uint64_t low;
+
+			//
+			friend bool operator == (const UInt128& A, const UInt128& B) = default;
+
+			//
+			friend std::strong_ordering operator <=> (const UInt128& A, const UInt128& B) = default;
+
+			//
+			friend UInt128 operator + (const UInt128& A, const UInt128& B)
+			{
+				std::uint64_t low = A.low + B.low;
+				return UInt128{ A.high + B.high + (low < A.low ? 1u : 0u), low };
+			}
+
+			//
+			friend UInt128 operator - (const UInt128& A, const UInt128& B)
+			{
+				return UInt128{ A.high - B.high - (A.low < B.low ? 1u : 0u), A.low - B.low };
+			}
+		};
+
+		// Double width arithmetic on unsigned integers of up to 64 bits: the full
+		// product of two of them, and division of such a product by one of them.
+		template <std::unsigned_integral U, bool Native =
+		#if defined(__SIZEOF_INT128__)
+			true
+		#else
+			(sizeof(U) <= 4u)
+		#endif
+		> struct WideArithmetic
+		{
+			#if defined(__SIZEOF_INT128__)
+				__extension__ typedef unsigned __int128 uint128;
+			#else
+				using uint128 = std::uint64_t;
+			#endif
+
+			using type = std::conditional_t<(sizeof(U) <= 4u), std::uint64_t, uint128>;
+
+			//
+			static type multiply(U a, U b)
+			{
+				return static_cast<type>(a) * static_cast<type>(b);
+			}
+
+			//
+			static type divide(type n, U d)
+			{
+				return n / d;
+			}
+
+			//
+			static U remainder(type n, U d)
+			{
+				return static_cast<U>(n % d);
+			}
+
+			// Sets out to x and returns true if x is no greater than limit.
+			static bool narrow(type x, U limit, U& out)
+			{
+				if (x > limit)
+					return false;
+
+				out = static_cast<U>(x);
+				return true;
+			}
+		};
+
+		template <std::unsigned_integral U> struct WideArithmetic<U, false>
+		{
+			using type = UInt128;
+
+			//
+			static type multiply(U a, U b)
+			{
+				std::uint64_t a_low = a & 0xFFFFFFFFu, a_high = static_cast<std::uint64_t>(a) >> 32;
+				std::uint64_t b_low = b & 0xFFFFFFFFu, b_high = static_cast<std::uint64_t>(b) >> 32;
+
+				std::uint64_t low_low = a_low * b_low;
+				std::uint64_t low_high = a_low * b_high;
+				std::uint64_t high_low = a_high * b_low;
+				std::uint64_t middle = (low_low >> 32) + (low_high & 0xFFFFFFFFu) + (high_low & 0xFFFFFFFFu);
+
+				return UInt128{ a_high * b_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32),
+				                (middle << 32) | (low_low & 0xFFFFFFFFu) };
+			}
+
+			// Long division, one bit at a time.
+			static type divide(type n, U d, U* rest = nullptr)
+			{
+				if (n.high == 0u)
+				{
+					if (rest != nullptr)
+						*rest = static_cast<U>(n.low % d);
+
+					return UInt128{ 0u, n.low / d };
+				}
+
+				UInt128 quotient{ 0u, 0u };
+				std::uint64_t r = 0u;
+
+				for (int i = 127; i >= 0; --i)
+				{
+					bool carry = (r >> 63) != 0u;
+					std::uint64_t bit = i >= 64 ? (n.high >> (i - 64)) & 1u : (n.low >> i) & 1u;
+					r = (r << 1) | bit;
+
+					// With the carry, r stands for 2^64 + r, which is always at least d.
+					if (carry || r >= d)
+					{
+						r -= d;
+
+						if (i >= 64)
+							quotient.high |= std::uint64_t(1u) << (i - 64);
+						else
+							quotient.low |= std::uint64_t(1u) << i;
+					}
+				}
+
+				if (rest != nullptr)
+					*rest = static_cast<U>(r);
+
+				return quotient;
+			}
+
+			//
+			static U remainder(type n, U d)
+			{
+				U rest;
+				divide(n, d, &rest);
+				return rest;
+			}
+
+			//
+			static bool narrow(type x, U limit, U& out)
+			{
+				if (x.high != 0u || x.low > limit)
+					return false;
+
+				out = static_cast<U>(x.low);
+				return true;
+			}
+		};
+
+		// Returns the greatest common divisor of a and b by Stein's binary
+		// algorithm, which needs only shifts and subtractions.
+		template <std::unsigned_integral U> U binary_gcd(U a, U b)
+		{
+			if (a == 0u)
+				return b;
+			if (b == 0u)
+				return a;
+
+			int shift = std::countr_zero(static_cast<U>(a | b));
+			a >>= std::countr_zero(a);
+
+			do
+			{
+				b >>= std::countr_zero(b);
+
+				if (a > b)
+					std::swap(a, b);
+
+				b -= a;
+			}
+			while (b != 0u);
+
+			return static_cast<U>(a << shift);
+		}
+
+		// Returns the absolute value of value as an unsigned integer,
+		// which holds it even for the most negative value of T.
+		template <std::integral T> std::make_unsigned_t<T> magnitude(T value)
+		{
+			using U = std::make_unsigned_t<T>;
+
+			if constexpr (std::is_signed_v<T>)
+			{
+				if (value < 0)
+					return static_cast<U>(U(0u) - static_cast<U>(value));
+			}
+
+			return static_cast<U>(value);
+		}
+	}
+
+	// This class provides an exact representation of the quotient of two
+	// integers by storing them and allowing fraction arithmetic with them.
 	// Use the member function evaluate() to obtain the result of the fraction.
+	//
+	// Every constructor and operator leaves the Fraction normalised: divided
+	// through by the greatest common divisor, with the sign on the numerator.
+	// Sums and products are reduced while they are formed, and formed in
+	// integers twice as wide as T, so an intermediate only overflows if the
+	// reduced result itself does not fit T. A result that does not fit throws
+	// std::overflow_error rather than wrapping, and the outcome of any sequence
+	// of operations is the same on every platform, which suits deterministic
+	// lockstep simulation.
+	//
+	// A Fraction with a denominator of 0 is invalid. It may be constructed,
+	// but any arithmetic or comparison with one throws std::domain_error.
 	template <std::integral T> class Fraction
 	{
+		using U = std::make_unsigned_t<T>;
+		using Wide = priv::WideArithmetic<U>;
+
+		// The sign and magnitudes of a Fraction.
+		struct Parts
+		{
+			bool negative;
+			U numer;
+			U denom;
+		};
+
+		//
+		Parts parts() const
+		{
+			if (denom == 0)
+				throw std::domain_error("Fraction has a denominator of 0");
+
+			bool negative = false;
+
+			if constexpr (std::is_signed_v<T>)
+				negative = numer != 0 && ((numer < 0) != (denom < 0));
+
+			return Parts{ negative, priv::magnitude(numer), priv::magnitude(denom) };
+		}
+
+		// Sets the Fraction to the given sign and magnitudes, which must
+		// have no common divisor. Throws std::overflow_error if it does not fit T.
+		void assign(bool negative, U new_numer, U new_denom)
+		{
+			U limit = static_cast<U>(std::numeric_limits<T>::max());
+			U numer_limit = limit;
+
+			if constexpr (std::is_signed_v<T>)
+			{
+				if (negative)
+					numer_limit = static_cast<U>(limit + 1u);
+			}
+			else if (negative && new_numer != 0u)
+				throw std::overflow_error("Fraction overflow");
+
+			if (new_numer > numer_limit || new_denom > limit)
+				throw std::overflow_error("Fraction overflow");
+
+			numer = negative ? static_cast<T>(U(0u) - new_numer) : static_cast<T>(new_numer);
+			denom = static_cast<T>(new_denom);
+		}
+
+		//
+		void assign(bool negative, const typename Wide::type& new_numer, const typename Wide::type& new_denom)
+		{
+			U n, d;
+
+			if (!Wide::narrow(new_numer, std::numeric_limits<U>::max(), n) || !Wide::narrow(new_denom, std::numeric_limits<U>::max(), d))
+				throw std::overflow_error("Fraction overflow");
+
+			assign(negative, n, d);
+		}
+
+		// Adds other, or subtracts it if subtract is true.
+		void add(const Fraction& other, bool subtract)
+		{
+			Parts a = parts();
+			Parts b = other.parts();
+
+			if (subtract)
+				b.negative = !b.negative;
+
+			// a/b + c/d = (a * d/g + c * b/g) / (b/g * d), with g = gcd(b, d).
+			// Anything the sum and g have in common is then all that is left to cancel.
+			U g = priv::binary_gcd(a.denom, b.denom);
+			typename Wide::type x = Wide::multiply(a.numer, static_cast<U>(b.denom / g));
+			typename Wide::type y = Wide::multiply(b.numer, static_cast<U>(a.denom / g));
+			typename Wide::type sum;
+			bool negative;
+
+			if (a.negative == b.negative)
+			{
+				sum = x + y;
+				negative = a.negative;
+
+				if (sum < x)
+					throw std::overflow_error("Fraction overflow");
+			}
+			else if (x >= y)
+			{
+				sum = x - y;
+				negative = a.negative;
+			}
+			else
+			{
+				sum = y - x;
+				negative = b.negative;
+			}
+
+			if (sum == typename Wide::type{})
+			{
+				numer = static_cast<T>(0);
+				denom = static_cast<T>(1);
+				return;
+			}
+
+			U h = priv::binary_gcd(Wide::remainder(sum, g), g);
+			assign(negative, Wide::divide(sum, h), Wide::multiply(static_cast<U>(a.denom / g), static_cast<U>(b.denom / h)));
+		}
+
+		// Multiplies by the given sign and magnitudes, dividing out
+		// the common divisors across the two Fractions first.
+		void multiply(const Parts& a, const Parts& b)
+		{
+			U g = priv::binary_gcd(a.numer, b.denom);
+			U h = priv::binary_gcd(b.numer, a.denom);
+
+			if (a.numer == 0u || b.numer == 0u)
+			{
+				numer = static_cast<T>(0);
+				denom = static_cast<T>(1);
+				return;
+			}
+
+			assign(a.negative != b.negative, Wide::multiply(static_cast<U>(a.numer / g), static_cast<U>(b.numer / h)),
+			       Wide::multiply(static_cast<U>(a.denom / h), static_cast<U>(b.denom / g)));
+		}
+
+		// Returns value as a Fraction.
+		// Throws std::overflow_error if value does not fit T.
+		template <std::integral V> static Fraction fromInteger(V value)
+		{
+			if (!std::in_range<T>(value))
+				throw std::overflow_error("Fraction overflow");
+
+			return Fraction(static_cast<T>(value));
+		}
+
 		public:
 
 		T numer;
@@ -62,12 +407,10 @@ namespace sf
 		}
 
 		// 2-int constructor.
-		// Sets the numerator of the Fraction to numer.
-		// Sets the denominator of the Fraction to denom.
+		// Sets the Fraction to new_numer / new_denom, normalised.
 		Fraction(T new_numer, T new_denom)
 		{
-			numer = new_numer;
-			denom = new_denom;
+			setAll(new_numer, new_denom);
 		}
 
 		// Copy constructor.
@@ -100,42 +443,87 @@ namespace sf
 		// Destroys the Fraction and its data.
 		~Fraction() = default;
 
-		// Sets the numerator of the Fraction to numer.
-		// Sets the denominator of the Fraction to denom.
+		// Sets the Fraction to new_numer / new_denom, normalised.
 		void setAll(T new_numer, T new_denom)
 		{
 			numer = new_numer;
 			denom = new_denom;
+			normalize();
 		}
 
-		// Raises both the numerator and denominator of the Fraction to the nth power.
-		template <std::unsigned_integral U> void pow(U n)
+		// Divides the numerator and denominator through by their greatest
+		// common divisor and moves the sign onto the numerator. Only needed
+		// after numer or denom are changed directly. Leaves an invalid
+		// Fraction as it is. Throws std::overflow_error if the normalised
+		// Fraction does not fit T, as with a denominator of the most negative T.
+		void normalize()
 		{
-			if (n == 1)
+			if (denom == 0)
 				return;
 
-			if (n == 0)
+			Parts p = parts();
+
+			if (p.numer == 0u)
 			{
-				numer = static_cast<U>(1);
-				denom = static_cast<U>(1);
+				denom = static_cast<T>(1);
 				return;
 			}
 
-			T old_numer = numer;
-			T old_denom = denom;
+			U g = priv::binary_gcd(p.numer, p.denom);
+			assign(p.negative, static_cast<U>(p.numer / g), static_cast<U>(p.denom / g));
+		}
+
+		// Raises the Fraction to the nth power by repeated squaring.
+		// A negative n raises the reciprocal to the power of -n.
+		// Throws std::domain_error if 0 is raised to a negative power.
+		template <std::integral V> void pow(V n)
+		{
+			Parts base = parts();
+			std::make_unsigned_t<V> exponent = priv::magnitude(n);
+
+			if constexpr (std::is_signed_v<V>)
+			{
+				if (n < 0)
+				{
+					if (base.numer == 0u)
+						throw std::domain_error("Fraction division by 0");
+
+					std::swap(base.numer, base.denom);
+				}
+			}
+
+			// Powers of a normalised Fraction are already normalised.
+			U limit = std::numeric_limits<U>::max();
+			U result_numer = 1u;
+			U result_denom = 1u;
+			bool negative = base.negative && (exponent & 1u) != 0u;
 
-			for (U i = 0; i < n; ++i)
+			while (exponent != 0u)
 			{
-				numer *= old_numer;
-				denom *= old_denom;
+				if ((exponent & 1u) != 0u)
+				{
+					if (!Wide::narrow(Wide::multiply(result_numer, base.numer), limit, result_numer)
+						|| !Wide::narrow(Wide::multiply(result_denom, base.denom), limit, result_denom))
+						throw std::overflow_error("Fraction overflow");
+				}
+
+				exponent >>= 1;
+
+				if (exponent != 0u)
+				{
+					if (!Wide::narrow(Wide::multiply(base.numer, base.numer), limit, base.numer)
+						|| !Wide::narrow(Wide::multiply(base.denom, base.denom), limit, base.denom))
+						throw std::overflow_error("Fraction overflow");
+				}
 			}
+
+			assign(negative, result_numer, result_denom);
 		}
 
 		// Returns the result of the Fraction as a float.
-		// This function may throw if a division by 0 is attempted.
 		float evaluate() const
 		{
-			return (1.f * numer) / (1.f * denom);
+			return static_cast<float>(numer) / static_cast<float>(denom);
 		}
 
 		// Returns true if the denominator of the Fraction is NOT 0.
@@ -145,7 +533,7 @@ namespace sf
 		}
 
 		// Returns true if the denominator of the Fraction is NOT 0.
-		operator bool() const
+		explicit operator bool() const
 		{
 			return (denom != 0);
 		}
@@ -156,11 +544,40 @@ namespace sf
 			return std::to_string(numer) + " / " + std::to_string(denom);
 		}
 
+		// Returns -1, 0 or 1 as the Fraction is less than,
+		// equal to or greater than other, compared exactly.
+		std::strong_ordering compare(const Fraction& other) const
+		{
+			Parts a = parts();
+			Parts b = other.parts();
+
+			if (a.negative != b.negative)
+				return a.negative ? std::strong_ordering::less : std::strong_ordering::greater;
+
+			typename Wide::type x = Wide::multiply(a.numer, b.denom);
+			typename Wide::type y = Wide::multiply(b.numer, a.denom);
+
+			return a.negative ? y <=> x : x <=> y;
+		}
+
+		// Negation operator.
+		// Throws std::overflow_error if the result does not fit T.
+		Fraction operator - () const
+		{
+			Parts p = parts();
+			Fraction fr;
+
+			if (p.numer != 0u)
+				fr.assign(!p.negative, p.numer, p.denom);
+
+			return fr;
+		}
+
 		// Preincrement operator.
 		// Adds 1 onto the Fraction.
 		Fraction& operator ++ ()
 		{
-			numer += denom;
+			add(Fraction(static_cast<T>(1)), false);
 			return *this;
 		}
 
@@ -178,7 +595,7 @@ namespace sf
 		// Subtracts 1 from the Fraction.
 		Fraction& operator -- ()
 		{
-			numer -= denom;
+			add(Fraction(static_cast<T>(1)), true);
 			return *this;
 		}
 
@@ -193,300 +610,207 @@ namespace sf
 		}
 
 		// Addition assignment operator.
-		// Adds the components of the given Fraction onto the
-		// corresponding components of this Fraction.
+		// Adds the given Fraction onto this Fraction.
 		Fraction& operator += (const Fraction & other)
 		{
-			if (denom == other.denom)
-			{
-				numer += other.numer;
-				return *this;
-			}
-
-			numer *= other.denom;
-			denom *= other.denom;
-
-			numer += other.numer * denom;
+			add(other, false);
 			return *this;
 		}
 
 		// Addition assignment operator.
 		// Adds the given value onto this Fraction.
-		template <std::integral U> Fraction& operator += (U value)
+		template <std::integral V> Fraction& operator += (V value)
 		{
-			numer += value * denom;
+			add(fromInteger(value), false);
 			return *this;
 		}
 
 		// Subtraction assignment operator.
-		// Subtracts the components of the given Fraction from the
-		// corresponding components of this Fraction.
+		// Subtracts the given Fraction from this Fraction.
 		Fraction& operator -= (const Fraction & other)
 		{
-			if (denom == other.denom)
-			{
-				numer -= other.numer;
-				return *this;
-			}
-
-			numer *= other.denom;
-			denom *= other.denom;
-
-			numer -= other.numer * denom;
+			add(other, true);
 			return *this;
 		}
 
 		// Subtraction assignment operator.
 		// Subtracts the given value from this Fraction.
-		template <std::integral Ty> Fraction& operator -= (Ty value)
+		template <std::integral V> Fraction& operator -= (V value)
 		{
-			numer -= value * denom;
+			add(fromInteger(value), true);
 			return *this;
 		}
 
 		// Multiplication assignment operator.
-		// Multiplies the components of this Fraction by the
-		// corresponding components of the given Fraction.
+		// Multiplies this Fraction by the given Fraction.
 		Fraction& operator *= (const Fraction & other)
 		{
-			numer *= other.numer;
-			denom *= other.denom;
-
+			multiply(parts(), other.parts());
 			return *this;
 		}
 
 		// Multiplication assignment operator.
-		// Multiplies the numerator of this Fraction by the given value.
-		template <std::integral U> Fraction& operator *= (U value)
+		// Multiplies this Fraction by the given value.
+		template <std::integral V> Fraction& operator *= (V value)
 		{
-			numer *= value;
-			return *this;
+			return *this *= fromInteger(value);
 		}
 
 		// Division assignment operator.
-		// Divides the components of this Fraction by the
-		// corresponding components of the given Fraction.
+		// Divides this Fraction by the given Fraction.
+		// Throws std::domain_error if other is 0.
 		Fraction& operator /= (const Fraction & other)
 		{
-			numer *= other.denom;
-			denom *= other.numer;
+			Parts b = other.parts();
 
+			if (b.numer == 0u)
+				throw std::domain_error("Fraction division by 0");
+
+			std::swap(b.numer, b.denom);
+			multiply(parts(), b);
 			return *this;
 		}
 
 		// Division assignment operator.
-		// Divides the numerator of this Fraction by the given value.
-		template <std::integral U> Fraction& operator /= (U value)
+		// Divides this Fraction by the given value.
+		// Throws std::domain_error if value is 0.
+		template <std::integral V> Fraction& operator /= (V value)
 		{
-			denom *= value;
-			return *this;
+			return *this /= fromInteger(value);
 		}
 	};
-}
-
-// Addition operator.
-template <std::integral T, std::integral U, std::integral V>
-sf::Fraction<T> operator + (const sf::Fraction<U>& A, const sf::Fraction<V>& B)
-{
-	sf::Fraction<T> new_fr(A);
-	new_fr += B;
-	return new_fr;
-}
-
-// Addition operator.
-template <std::integral T, std::integral U, std::integral V>
-sf::Fraction<T> operator + (const sf::Fraction<U>& fr, V value)
-{
-	sf::Fraction<T> new_fr(fr);
-	new_fr += value;
-	return new_fr;
-}
-
-// Subtraction operator.
-template <std::integral T, std::integral U, std::integral V>
-sf::Fraction<T> operator - (const sf::Fraction<U>& A, const sf::Fraction<V>& B)
-{
-	sf::Fraction<T> new_fr(A);
-	new_fr -= B;
-	return new_fr;
-}
 
-// Subtraction operator.
-template <std::integral T, std::integral U, std::integral V>
-sf::Fraction<T> operator - (const sf::Fraction<U>& fr, V value)
-{
-	sf::Fraction<T> new_fr(fr);
-	new_fr -= value;
-	return new_fr;
-}
-
-// Multiplication operator.
-template <std::integral T, std::integral U, std::integral V>
-sf::Fraction<T> operator * (const sf::Fraction<U>& A, const sf::Fraction<V>& B)
-{
-	sf::Fraction<T> new_fr(A);
-	new_fr *= B;
-	return new_fr;
-}
-
-// Multiplication operator.
-template <std::integral T, std::integral U, std::integral V>
-sf::Fraction<T> operator * (const sf::Fraction<U>& fr, V value)
-{
-	sf::Fraction<T> new_fr(fr);
-	new_fr *= value;
-	return new_fr;
-}
-
-// Division operator.
-template <std::integral T, std::integral U, std::integral V>
-sf::Fraction<T> operator / (const sf::Fraction<U>& A, const sf::Fraction<V>& B)
-{
-	sf::Fraction<T> new_fr(A);
-	new_fr /= B;
-	return new_fr;
-}
-
-// Division operator.
-template <std::integral T, std::integral U, std::integral V>
-sf::Fraction<T> operator / (const sf::Fraction<U>& fr, V value)
-{
-	sf::Fraction<T> new_fr(fr);
-	new_fr /= value;
-	return new_fr;
-}
-
-// Equality comparison operator.
-// Returns true if A.evaluate() == B.evaluate().
-template <std::integral T, std::integral U>
-bool operator == (const sf::Fraction<T>& A, const sf::Fraction<U>& B)
-{
-	return A.evaluate() == B.evaluate();
-}
-
-// Equality comparison operator.
-// - Returns true if fr.evaluate() == f.
-// - Returns false otherwise.
-template <std::integral T>
-bool operator == (const sf::Fraction<T>& fr, float f)
-{
-	return fr.evaluate() == f;
-}
-
-// Inequality comparison operator.
-// - Returns true if A.evaluate() != B.evaluate().
-// - Returns false otherwise.
-template <std::integral T, std::integral U>
-bool operator != (const sf::Fraction<T>& A, const sf::Fraction<U>& B)
-{
-	return A.evaluate() != B.evaluate();
-}
-
-// Inequality comparison operator.
-// - Returns true if fr.evaluate() != f.
-// - Returns false otheriwse.
-template <std::integral T>
-bool operator != (const sf::Fraction<T>& fr, float f)
-{
-	return fr.evaluate() != f;
-}
-
-// Greater than comparison operator.
-// - Returns true if A.evaluate() > B.evaluate().
-// - Returns false otherwise.
-template <std::integral T, std::integral U>
-bool operator > (const sf::Fraction<T>& A, const sf::Fraction<U>& B)
-{
-	return A.evaluate() > B.evaluate();
-}
+	// Addition operator.
+	template <std::integral T>
+	Fraction<T> operator + (Fraction<T> A, const Fraction<T>& B)
+	{
+		A += B;
+		return A;
+	}
 
-// Greater than comparison operator.
-// - Returns true if fr.evaluate() > f.
-// - Returns false otherwise.
-template <std::integral T>
-bool operator > (const sf::Fraction<T>& fr, float f)
-{
-	return fr.evaluate() > f;
-}
+	// Addition operator.
+	template <std::integral T, std::integral V>
+	Fraction<T> operator + (Fraction<T> fr, V value)
+	{
+		fr += value;
+		return fr;
+	}
 
-// Greater than or equal to comparison operators.
-// - Returns true if A.evaluate() >= B.evaluate().
-// - Returns false otherwise.
-template <std::integral T, std::integral U>
-bool operator >= (const sf::Fraction<T>& A, const sf::Fraction<U>& B)
-{
-	return A.evaluate() >= B.evaluate();
-}
+	// Addition operator.
+	template <std::integral T, std::integral V>
+	Fraction<T> operator + (V value, Fraction<T> fr)
+	{
+		fr += value;
+		return fr;
+	}
 
-// Greater than or equal to comparison operators.
-// - Returns true if fr.evaluate() >= f.
-// - Returns false otherwise.
-template <std::integral T>
-bool operator >= (const sf::Fraction<T>& fr, float f)
-{
-	return fr.evaluate() >= f;
-}
+	// Subtraction operator.
+	template <std::integral T>
+	Fraction<T> operator - (Fraction<T> A, const Fraction<T>& B)
+	{
+		A -= B;
+		return A;
+	}
 
-// Less than comparison operator.
-// - Returns true if A.evaluate() < B.evaluate().
-// - Returns false otherwise.
-template <std::integral T, std::integral U>
-bool operator < (const sf::Fraction<T>& A, const sf::Fraction<U>& B)
-{
-	return A.evaluate() < B.evaluate();
-}
+	// Subtraction operator.
+	template <std::integral T, std::integral V>
+	Fraction<T> operator - (Fraction<T> fr, V value)
+	{
+		fr -= value;
+		return fr;
+	}
 
-// Less than comparison operator.
-// - Returns true if fr.evaluate() < f.
-// - Returns false otherwise.
-template <std::integral T>
-bool operator < (const sf::Fraction<T>& fr, float f)
-{
-	return fr.evaluate() < f;
-}
+	// Subtraction operator.
+	template <std::integral T, std::integral V>
+	Fraction<T> operator - (V value, const Fraction<T>& fr)
+	{
+		Fraction<T> new_fr;
+		new_fr += value;
+		new_fr -= fr;
+		return new_fr;
+	}
+
+	// Multiplication operator.
+	template <std::integral T>
+	Fraction<T> operator * (Fraction<T> A, const Fraction<T>& B)
+	{
+		A *= B;
+		return A;
+	}
 
-// Less than or equal to comparison operator.
-// - Returns true if A.evaluate() <= B.evaluate().
-// - Returns false otherwise.
-template <std::integral T, std::integral U>
-bool operator <= (const sf::Fraction<T>& A, const sf::Fraction<U>& B)
-{
-	return A.evaluate() <= B.evaluate();
-}
+	// Multiplication operator.
+	template <std::integral T, std::integral V>
+	Fraction<T> operator * (Fraction<T> fr, V value)
+	{
+		fr *= value;
+		return fr;
+	}
 
-// Less than or equal to comparison operator.
-// - Returns true if fr.evaluate() <= f.
-// - Returns false otherwise.
-template <std::integral T>
-bool operator <= (const sf::Fraction<T>& fr, float f)
-{
-	return fr.evaluate() <= f;
-}
+	// Multiplication operator.
+	template <std::integral T, std::integral V>
+	Fraction<T> operator * (V value, Fraction<T> fr)
+	{
+		fr *= value;
+		return fr;
+	}
 
-// Three-way comparison operator.
-template <std::integral T, std::integral U>
-std::strong_ordering operator <=> (const sf::Fraction<T>& A, const sf::Fraction<U>& B)
-{
-	if (A.evaluate() < B.evaluate())
-		return std::strong_ordering::less;
+	// Division operator.
+	template <std::integral T>
+	Fraction<T> operator / (Fraction<T> A, const Fraction<T>& B)
+	{
+		A /= B;
+		return A;
+	}
 
-	if (A.evaluate() > B.evaluate())
-		return std::strong_ordering::greater;
+	// Division operator.
+	template <std::integral T, std::integral V>
+	Fraction<T> operator / (Fraction<T> fr, V value)
+	{
+		fr /= value;
+		return fr;
+	}
 
-	return std::strong_ordering::equal;
-}
+	// Division operator.
+	template <std::integral T, std::integral V>
+	Fraction<T> operator / (V value, const Fraction<T>& fr)
+	{
+		Fraction<T> new_fr;
+		new_fr += value;
+		new_fr /= fr;
+		return new_fr;
+	}
+
+	// Equality comparison operator.
+	// Returns true if A and B are exactly equal.
+	template <std::integral T>
+	bool operator == (const Fraction<T>& A, const Fraction<T>& B)
+	{
+		return A.compare(B) == 0;
+	}
 
-// Three-way comparison operator.
-template <std::integral T>
-std::strong_ordering operator <=> (const sf::Fraction<T>& fr, float f)
-{
-	if (fr.evaluate() < f)
-		return std::strong_ordering::less;
+	// Three-way comparison operator.
+	// Compares A and B exactly.
+	template <std::integral T>
+	std::strong_ordering operator <=> (const Fraction<T>& A, const Fraction<T>& B)
+	{
+		return A.compare(B);
+	}
 
-	if (fr.evaluate() > f)
-		return std::strong_ordering::greater;
+	// Equality comparison operator.
+	// Returns true if fr.evaluate() == f.
+	template <std::integral T>
+	bool operator == (const Fraction<T>& fr, float f)
+	{
+		return fr.evaluate() == f;
+	}
 
-	return std::strong_ordering::equal;
+	// Three-way comparison operator.
+	// Compares fr.evaluate() with f.
+	template <std::integral T>
+	std::partial_ordering operator <=> (const Fraction<T>& fr, float f)
+	{
+		return fr.evaluate() <=> f;
+	}
 }
 
 #endif // SFML_FRACTION_HPP
\ No newline at end of file
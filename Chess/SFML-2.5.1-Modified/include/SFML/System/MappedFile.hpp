@@ -0,0 +1,223 @@
+////////////////////////////////////////////////////////////
+// 
+// This is an added file for this modified version of SFML 2.5.1
+// Modified by Justyn Durnford
+// Last modified on 2026-10-16
+// 
+// SFML - Simple and Fast Multimedia Library
+// Copyright (X) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_MAPPEDFILE_HPP
+#define SFML_MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#if defined(_WIN32)
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace sf
+{
+	// A file mapped read-only into memory. The operating system reads
+	// each page of the file in the first time it is touched, so opening
+	// even a very large file costs next to nothing until it is read.
+	//
+	// Not included by System.hpp, since it brings in the platform headers.
+	class MappedFile
+	{
+		const std::byte* data_;
+		std::size_t size_;
+
+		#if defined(_WIN32)
+			HANDLE file_;
+			HANDLE mapping_;
+		#endif
+
+		public:
+
+		//
+		MappedFile()
+			: data_(nullptr), size_(0u)
+		#if defined(_WIN32)
+			, file_(INVALID_HANDLE_VALUE), mapping_(nullptr)
+		#endif
+		{}
+
+		MappedFile(const MappedFile& other) = delete;
+		MappedFile& operator = (const MappedFile& other) = delete;
+
+		//
+		MappedFile(MappedFile&& other) noexcept
+			: MappedFile()
+		{
+			swap(other);
+		}
+
+		//
+		MappedFile& operator = (MappedFile&& other) noexcept
+		{
+			MappedFile moved(std::move(other));
+			swap(moved);
+			return *this;
+		}
+
+		//
+		~MappedFile()
+		{
+			close();
+		}
+
+		//
+		void swap(MappedFile& other) noexcept
+		{
+			std::swap(data_, other.data_);
+			std::swap(size_, other.size_);
+
+			#if defined(_WIN32)
+				std::swap(file_, other.file_);
+				std::swap(mapping_, other.mapping_);
+			#endif
+		}
+
+		// Maps the whole of filename, closing any file mapped before.
+		// Returns false if the file cannot be opened or is empty.
+		bool open(const std::string& filename)
+		{
+			close();
+
+			#if defined(_WIN32)
+				file_ = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+				                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+				if (file_ == INVALID_HANDLE_VALUE)
+					return false;
+
+				LARGE_INTEGER size;
+
+				if (!GetFileSizeEx(file_, &size) || size.QuadPart == 0)
+				{
+					close();
+					return false;
+				}
+
+				mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+				if (mapping_ == nullptr)
+				{
+					close();
+					return false;
+				}
+
+				data_ = static_cast<const std::byte*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+
+				if (data_ == nullptr)
+				{
+					close();
+					return false;
+				}
+
+				size_ = static_cast<std::size_t>(size.QuadPart);
+			#else
+				int fd = ::open(filename.c_str(), O_RDONLY);
+
+				if (fd < 0)
+					return false;
+
+				struct stat info;
+
+				if (fstat(fd, &info) != 0 || info.st_size == 0)
+				{
+					::close(fd);
+					return false;
+				}
+
+				void* address = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+				// The mapping keeps the file alive on its own.
+				::close(fd);
+
+				if (address == MAP_FAILED)
+					return false;
+
+				data_ = static_cast<const std::byte*>(address);
+				size_ = static_cast<std::size_t>(info.st_size);
+			#endif
+
+			return true;
+		}
+
+		// Unmaps the file, if one is mapped.
+		void close()
+		{
+			#if defined(_WIN32)
+				if (data_ != nullptr)
+					UnmapViewOfFile(data_);
+				if (mapping_ != nullptr)
+					CloseHandle(mapping_);
+				if (file_ != INVALID_HANDLE_VALUE)
+					CloseHandle(file_);
+
+				mapping_ = nullptr;
+				file_ = INVALID_HANDLE_VALUE;
+			#else
+				if (data_ != nullptr)
+					munmap(const_cast<std::byte*>(data_), size_);
+			#endif
+
+			data_ = nullptr;
+			size_ = 0u;
+		}
+
+		//
+		bool isOpen() const
+		{
+			return data_ != nullptr;
+		}
+
+		// Returns the first byte of the file, or null if none is mapped.
+		const std::byte* data() const
+		{
+			return data_;
+		}
+
+		// Returns the size of the file in bytes.
+		std::size_t size() const
+		{
+			return size_;
+		}
+	};
+}
+
+#endif // SFML_MAPPEDFILE_HPP
\ No newline at end of file
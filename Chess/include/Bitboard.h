@@ -0,0 +1,145 @@
+// Chess
+// Bitboard.h
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Header file for the Bitboard type and its precomputed attack tables.
+
+#pragma once
+
+#include "Define.h"
+
+#include <bit>
+
+#if defined(CHESS_USE_PEXT)
+#include <immintrin.h>
+#endif
+
+// A Bitboard holds one bit per square.
+// Bit 0 is a1, bit 7 is h1, bit 56 is a8 and bit 63 is h8.
+typedef uint64_t Bitboard;
+
+const uint8_t WHITE = 0u;
+const uint8_t BLACK = 1u;
+
+const uint8_t NO_SQUARE = 64u;
+
+const Bitboard FILE_A_BB = 0x0101010101010101ull;
+const Bitboard FILE_H_BB = FILE_A_BB << 7;
+const Bitboard RANK_1_BB = 0xFFull;
+const Bitboard RANK_2_BB = RANK_1_BB << 8;
+const Bitboard RANK_4_BB = RANK_1_BB << 24;
+const Bitboard RANK_5_BB = RANK_1_BB << 32;
+const Bitboard RANK_7_BB = RANK_1_BB << 48;
+const Bitboard RANK_8_BB = RANK_1_BB << 56;
+
+// Attack lookup for one square of one sliding piece type.
+// The index into attacks is either (occupied & mask) * magic >> shift,
+// or the PEXT of occupied by mask when CHESS_USE_PEXT is defined.
+struct Magic
+{
+	Bitboard mask;
+	Bitboard magic;
+	Bitboard* attacks;
+	uint32_t shift;
+
+	uint32_t index(Bitboard occupied) const
+	{
+		#if defined(CHESS_USE_PEXT)
+		return static_cast<uint32_t>(_pext_u64(occupied, mask));
+		#else
+		return static_cast<uint32_t>(((occupied & mask) * magic) >> shift);
+		#endif
+	}
+};
+
+extern array<Bitboard, 64> knight_attacks;
+extern array<Bitboard, 64> king_attacks;
+extern array<array<Bitboard, 64>, 2> pawn_attacks;
+extern array<array<Bitboard, 64>, 64> between_bb;
+extern array<array<Bitboard, 64>, 64> line_bb;
+extern array<Magic, 64> rook_magics;
+extern array<Magic, 64> bishop_magics;
+
+// Fills every attack table above.
+// Must be called once before any Position is used.
+void init_bitboards();
+
+inline Bitboard square_bb(uint8_t sq)
+{
+	return 1ull << sq;
+}
+
+inline uint8_t file_of(uint8_t sq)
+{
+	return sq & 7u;
+}
+
+inline uint8_t rank_of(uint8_t sq)
+{
+	return sq >> 3;
+}
+
+inline uint8_t make_square(uint8_t file, uint8_t rank)
+{
+	return static_cast<uint8_t>((rank << 3) | file);
+}
+
+inline int popcount(Bitboard b)
+{
+	return std::popcount(b);
+}
+
+// Returns the index of the least significant set bit.
+// b must not be 0.
+inline uint8_t lsb(Bitboard b)
+{
+	return static_cast<uint8_t>(std::countr_zero(b));
+}
+
+// Returns the index of the least significant set bit and clears it.
+// b must not be 0.
+inline uint8_t pop_lsb(Bitboard& b)
+{
+	uint8_t sq = lsb(b);
+	b &= b - 1;
+	return sq;
+}
+
+// Returns true if b has more than one bit set.
+inline bool more_than_one(Bitboard b)
+{
+	return (b & (b - 1)) != 0;
+}
+
+// Shifts every bit of b one rank towards the opponent of color.
+inline Bitboard pawn_push(Bitboard b, uint8_t color)
+{
+	return color == WHITE ? b << 8 : b >> 8;
+}
+
+inline Bitboard rook_attacks(uint8_t sq, Bitboard occupied)
+{
+	const Magic& m = rook_magics[sq];
+	return m.attacks[m.index(occupied)];
+}
+
+inline Bitboard bishop_attacks(uint8_t sq, Bitboard occupied)
+{
+	const Magic& m = bishop_magics[sq];
+	return m.attacks[m.index(occupied)];
+}
+
+inline Bitboard queen_attacks(uint8_t sq, Bitboard occupied)
+{
+	return rook_attacks(sq, occupied) | bishop_attacks(sq, occupied);
+}
+
+// Returns true if the three squares lie on one rank, file or diagonal.
+inline bool aligned(uint8_t a, uint8_t b, uint8_t c)
+{
+	return (line_bb[a][b] & square_bb(c)) != 0;
+}
+
+// Returns a printable 8x8 diagram of the Bitboard, rank 8 first.
+string bitboard_to_string(Bitboard b);
\ No newline at end of file
@@ -0,0 +1,73 @@
+// Chess
+// Engine.h
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Header file for the Engine class.
+
+#pragma once
+
+#include "Search.h"
+
+#include <memory>
+#include <thread>
+
+// Runs a Lazy SMP search on its own threads so that the caller never blocks.
+//
+// start() launches one Search per thread, all sharing one TranspositionTable,
+// and returns immediately. The first thread is the main one: when its time
+// is up it raises the shared stop flag, which ends the helpers too. The
+// caller polls result() once per frame, and may cancel at any time with
+// stop(). The result is taken from whichever thread completed the deepest
+// iteration, preferring the main thread on ties.
+class Engine
+{
+	TranspositionTable tt_;
+	atomic<bool> stop_;
+	atomic<bool> finished_;
+	vector<unique_ptr<Search>> searches_;
+	vector<Move> moves_;
+	vector<thread> threads_;
+	size_t best_;
+
+	// Waits for every thread to return.
+	void join();
+
+	public:
+
+	// Creates an Engine using thread_count threads (0 for one per core)
+	// and a table of hash_size_mb megabytes.
+	Engine(uint32_t thread_count, size_t hash_size_mb);
+
+	Engine(const Engine& other) = delete;
+
+	Engine& operator = (const Engine& other) = delete;
+
+	// Cancels any running search.
+	~Engine();
+
+	// Starts searching pos for at most budget, cancelling any running search.
+	void start(const Position& pos, Time budget);
+
+	// Cancels the running search, if any, and discards its result.
+	void stop();
+
+	// Returns true if a search is running or has an uncollected result.
+	bool busy() const;
+
+	// Returns true and sets move once the search has finished.
+	// The result can only be collected once.
+	bool result(Move& move);
+
+	// Returns the number of search threads.
+	uint32_t threadCount() const;
+
+	// Returns the number of nodes visited by every thread in the last search.
+	uint64_t nodes() const;
+
+	// Returns the score of the last result, from the side to move's point of view.
+	int score() const;
+
+	// Returns the depth of the last result.
+	uint32_t depth() const;
+};
@@ -0,0 +1,19 @@
+// Chess
+// Evaluate.h
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Header file for the static evaluation.
+
+#pragma once
+
+#include "Position.h"
+
+// Material value of each piece type in centipawns, indexed by white Piece ID.
+const array<int, 6> piece_values = { 100, 500, 320, 330, 900, 20000 };
+
+// Returns the static evaluation of pos in centipawns,
+// from the point of view of the side to move.
+// Material plus piece-square tables, with the king table
+// blended between middlegame and endgame by remaining material.
+int evaluate(const Position& pos);
\ No newline at end of file
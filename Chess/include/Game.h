@@ -2,22 +2,45 @@
 // Game.h
 // Justyn Durnford
 // Created on 2021-05-16
-// Last modified on 2021-05-19
+// Last modified on 2026-10-16
 // Header file for the Game class.
 
 #pragma once
 
-#include "Piece.h"
+#include "Engine.h"
 
 extern array<Texture, 13> textures;
 extern array<Piece, 6> white_pieces;
 extern array<Piece, 6> black_pieces;
 
+// Length of one update step. Game always updates by exactly this much.
+const Time time_step = microseconds(16667);
+
+// Total time spent in each phase of the main loop.
+struct PhaseTimes
+{
+	Time events;
+	Time update;
+	Time render;
+	uint64_t frames = 0u;
+	uint64_t steps = 0u;
+	uint64_t droppedSteps = 0u;
+};
+
+// Updates in fixed steps of time_step, however long each frame takes.
+// After a stall, at most max_steps_per_frame steps are run to catch up
+// and the rest of the lost time is dropped.
 class Game
 {
 	RenderWindow window_;
 	Event event_;
 	map<Keyboard::Key, bool> keyboardInput_;
+	Position position_;
+	Engine engine_;
+	uint8_t engineColor_;
+	uint8_t selected_;
+	uint64_t searchedKey_;
+	PhaseTimes times_;
 
 	//
 	void processEvents();
@@ -25,6 +48,12 @@ class Game
 	//
 	void handleKeyboardInput(Keyboard::Key key, bool is_pressed);
 
+	// Selects a square, or moves the selected piece to it.
+	void handleMouseInput(int x, int y);
+
+	// Plays move for the player and starts the engine's reply.
+	void playerMove(Move move);
+
 	//
 	void update(Time dt);
 
@@ -33,6 +62,8 @@ class Game
 
 	public:
 
+	const static uint32_t max_steps_per_frame = 5u;
+
 	//
 	Game(uint32_t width, uint32_t height);
 
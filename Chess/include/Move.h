@@ -0,0 +1,166 @@
+// Chess
+// Move.h
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Header file for the Move and MoveList classes.
+
+#pragma once
+
+#include "Define.h"
+
+// A Move packs its origin square, destination square and kind into 16 bits:
+//  - bits 0-5:   origin square
+//  - bits 6-11:  destination square
+//  - bits 12-15: one of the flags below
+class Move
+{
+	uint16_t data_;
+
+	public:
+
+	const static uint8_t QUIET             = 0u;
+	const static uint8_t DOUBLE_PUSH       = 1u;
+	const static uint8_t KING_CASTLE       = 2u;
+	const static uint8_t QUEEN_CASTLE      = 3u;
+	const static uint8_t CAPTURE           = 4u;
+	const static uint8_t EN_PASSANT        = 5u;
+	const static uint8_t PROMOTE_KNIGHT    = 8u;
+	const static uint8_t PROMOTE_BISHOP    = 9u;
+	const static uint8_t PROMOTE_ROOK      = 10u;
+	const static uint8_t PROMOTE_QUEEN     = 11u;
+	const static uint8_t CAPTURE_KNIGHT    = 12u;
+	const static uint8_t CAPTURE_BISHOP    = 13u;
+	const static uint8_t CAPTURE_ROOK      = 14u;
+	const static uint8_t CAPTURE_QUEEN     = 15u;
+
+	// Creates the null Move (a1a1), which is never legal.
+	Move() : data_(0u) {}
+
+	Move(uint8_t from, uint8_t to, uint8_t flags)
+		: data_(static_cast<uint16_t>(from | (to << 6) | (flags << 12))) {}
+
+	// Creates the Move from the value returned by raw().
+	explicit Move(uint16_t raw) : data_(raw) {}
+
+	uint8_t from() const
+	{
+		return data_ & 0x3Fu;
+	}
+
+	uint8_t to() const
+	{
+		return (data_ >> 6) & 0x3Fu;
+	}
+
+	uint8_t flags() const
+	{
+		return static_cast<uint8_t>(data_ >> 12);
+	}
+
+	uint16_t raw() const
+	{
+		return data_;
+	}
+
+	bool isNull() const
+	{
+		return data_ == 0u;
+	}
+
+	bool isCapture() const
+	{
+		return (flags() & CAPTURE) != 0u;
+	}
+
+	bool isPromotion() const
+	{
+		return (flags() & PROMOTE_KNIGHT) != 0u;
+	}
+
+	bool isCastle() const
+	{
+		return flags() == KING_CASTLE || flags() == QUEEN_CASTLE;
+	}
+
+	// Returns the Piece type the pawn promotes to, as a white Piece ID.
+	// Only meaningful if isPromotion() is true.
+	uint8_t promotionType() const;
+
+	// Returns the Move in coordinate notation, e.g. "e2e4" or "e7e8q".
+	string toString() const;
+
+	bool operator == (const Move& other) const
+	{
+		return data_ == other.data_;
+	}
+
+	bool operator != (const Move& other) const
+	{
+		return data_ != other.data_;
+	}
+};
+
+// Fixed capacity list of Moves.
+// No legal chess position has more than 218 moves.
+class MoveList
+{
+	array<Move, 256> moves_;
+	size_t size_;
+
+	public:
+
+	MoveList() : size_(0u) {}
+
+	void push_back(Move move)
+	{
+		moves_[size_++] = move;
+	}
+
+	void clear()
+	{
+		size_ = 0u;
+	}
+
+	size_t size() const
+	{
+		return size_;
+	}
+
+	bool empty() const
+	{
+		return size_ == 0u;
+	}
+
+	bool contains(Move move) const;
+
+	Move& operator [] (size_t i)
+	{
+		return moves_[i];
+	}
+
+	const Move& operator [] (size_t i) const
+	{
+		return moves_[i];
+	}
+
+	Move* begin()
+	{
+		return moves_.data();
+	}
+
+	Move* end()
+	{
+		return moves_.data() + size_;
+	}
+
+	const Move* begin() const
+	{
+		return moves_.data();
+	}
+
+	const Move* end() const
+	{
+		return moves_.data() + size_;
+	}
+};
\ No newline at end of file
@@ -0,0 +1,17 @@
+// Chess
+// MoveGen.h
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Header file for the legal move generator.
+
+#pragma once
+
+#include "Position.h"
+
+// Appends every legal Move of the side to move to list.
+void generate_legal_moves(const Position& pos, MoveList& list);
+
+// Appends every legal capture and queen promotion of the side to move to list.
+// Used by the quiescence search; call generate_legal_moves when in check.
+void generate_legal_captures(const Position& pos, MoveList& list);
\ No newline at end of file
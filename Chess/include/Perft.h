@@ -0,0 +1,29 @@
+// Chess
+// Perft.h
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Header file for the perft node counters.
+
+#pragma once
+
+#include "MoveGen.h"
+
+// Node count of one root Move, as printed by divide.
+struct PerftEntry
+{
+	Move move;
+	uint64_t nodes;
+};
+
+// Returns the number of leaf nodes of the legal move tree of the given depth.
+// The last ply is bulk counted from the size of the move list.
+uint64_t perft(Position& pos, uint32_t depth);
+
+// Returns the node count below every root Move.
+// The root Moves are shared out between thread_count threads,
+// each of which searches its own copy of the Position.
+vector<PerftEntry> perft_divide(const Position& pos, uint32_t depth, uint32_t thread_count);
+
+// Returns the same count as perft(), split across thread_count threads.
+uint64_t perft_parallel(const Position& pos, uint32_t depth, uint32_t thread_count);
\ No newline at end of file
@@ -0,0 +1,211 @@
+// Chess
+// Position.h
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Header file for the Position class.
+
+#pragma once
+
+#include "Bitboard.h"
+#include "Move.h"
+#include "Piece.h"
+#include "Zobrist.h"
+
+const uint8_t NO_PIECE = 12u;
+
+const string start_fen = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+// Returns the color (WHITE or BLACK) of the given Piece ID.
+inline uint8_t piece_color(uint8_t piece)
+{
+	return piece >= Piece::BLACK_PAWN ? BLACK : WHITE;
+}
+
+// Returns the type of the given Piece ID, expressed as the white Piece ID.
+inline uint8_t piece_type(uint8_t piece)
+{
+	return piece >= Piece::BLACK_PAWN ? piece - Piece::BLACK_PAWN : piece;
+}
+
+// Returns the Piece ID of the given color and type.
+inline uint8_t make_piece(uint8_t color, uint8_t type)
+{
+	return color == WHITE ? type : type + Piece::BLACK_PAWN;
+}
+
+// Everything about a Position that cannot be recovered when a Move is taken back.
+struct StateInfo
+{
+	uint8_t castling;
+	uint8_t epSquare;
+	uint8_t halfmoveClock;
+	uint8_t captured;
+	uint64_t key;
+};
+
+// A chess position stored as one Bitboard per Piece ID,
+// plus a square-indexed board for fast piece lookups.
+class Position
+{
+	array<Bitboard, 12> pieces_;
+	array<Bitboard, 2> colors_;
+	array<uint8_t, 64> board_;
+	uint8_t sideToMove_;
+	uint16_t fullmoveNumber_;
+	StateInfo state_;
+	vector<StateInfo> history_;
+
+	//
+	void clear();
+
+	// Returns the Zobrist key of the position, computed from scratch.
+	uint64_t computeKey() const;
+
+	//
+	void putPiece(uint8_t piece, uint8_t sq);
+
+	//
+	void removePiece(uint8_t sq);
+
+	//
+	void movePiece(uint8_t from, uint8_t to);
+
+	public:
+
+	const static uint8_t WHITE_OO  = 1u;
+	const static uint8_t WHITE_OOO = 2u;
+	const static uint8_t BLACK_OO  = 4u;
+	const static uint8_t BLACK_OOO = 8u;
+
+	// Creates the standard starting position.
+	Position();
+
+	// Creates the position described by the given FEN string.
+	// Falls back to the empty board if the string is malformed.
+	Position(strref fen);
+
+	Position(const Position& other) = default;
+
+	Position(Position&& other) noexcept = default;
+
+	Position& operator = (const Position& other) = default;
+
+	Position& operator = (Position&& other) noexcept = default;
+
+	~Position() = default;
+
+	// Sets the position from the given FEN string.
+	// Returns false and leaves the board empty if the string is malformed.
+	bool setFEN(strref fen);
+
+	// Returns the FEN string of the position.
+	string fen() const;
+
+	Bitboard pieces(uint8_t piece) const
+	{
+		return pieces_[piece];
+	}
+
+	// Returns every piece of one type, of both colors.
+	Bitboard piecesOfType(uint8_t type) const
+	{
+		return pieces_[type] | pieces_[type + Piece::BLACK_PAWN];
+	}
+
+	Bitboard colorPieces(uint8_t color) const
+	{
+		return colors_[color];
+	}
+
+	Bitboard occupied() const
+	{
+		return colors_[WHITE] | colors_[BLACK];
+	}
+
+	uint8_t pieceOn(uint8_t sq) const
+	{
+		return board_[sq];
+	}
+
+	uint8_t sideToMove() const
+	{
+		return sideToMove_;
+	}
+
+	uint8_t castlingRights() const
+	{
+		return state_.castling;
+	}
+
+	uint8_t epSquare() const
+	{
+		return state_.epSquare;
+	}
+
+	uint8_t halfmoveClock() const
+	{
+		return state_.halfmoveClock;
+	}
+
+	uint16_t fullmoveNumber() const
+	{
+		return fullmoveNumber_;
+	}
+
+	// Returns the Piece ID captured by the last Move, or NO_PIECE.
+	uint8_t capturedPiece() const
+	{
+		return state_.captured;
+	}
+
+	// Returns the Zobrist key of the position.
+	// It is kept up to date incrementally by makeMove().
+	uint64_t key() const
+	{
+		return state_.key;
+	}
+
+	// Returns true if the position occurred before since the last
+	// capture or pawn move, with the same side to move.
+	bool isRepetition() const;
+
+	// Returns the number of Moves made since the position was set.
+	size_t gamePly() const
+	{
+		return history_.size();
+	}
+
+	uint8_t kingSquare(uint8_t color) const
+	{
+		return lsb(pieces_[make_piece(color, Piece::WHITE_KING)]);
+	}
+
+	// Returns every piece of either color that attacks sq,
+	// with sliding attacks blocked by the given occupancy.
+	Bitboard attackersTo(uint8_t sq, Bitboard occupied) const;
+
+	// Returns true if any piece of by_color attacks sq.
+	bool isAttacked(uint8_t sq, uint8_t by_color) const;
+
+	// Returns the enemy pieces giving check to the side to move.
+	Bitboard checkers() const;
+
+	bool inCheck() const
+	{
+		return checkers() != 0;
+	}
+
+	// Plays the given Move, which must be legal.
+	void makeMove(Move move);
+
+	// Takes back the given Move, which must be the last one made.
+	void unmakeMove(Move move);
+
+	// Returns the legal Move with the given coordinate notation,
+	// or the null Move if there is none.
+	Move parseMove(strref str) const;
+
+	// Returns a printable diagram of the board, rank 8 first.
+	string toString() const;
+};
\ No newline at end of file
@@ -0,0 +1,83 @@
+// Chess
+// Search.h
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Header file for the Search class.
+
+#pragma once
+
+#include "Evaluate.h"
+#include "MoveGen.h"
+#include "TranspositionTable.h"
+
+const int MAX_PLY = 128;
+const int INFINITE_SCORE = 32000;
+const int MATE_SCORE = 31000;
+
+// Negamax alpha-beta search with iterative deepening and quiescence search.
+// Moves are ordered by MVV-LVA for captures, then killer moves, then the
+// history heuristic. Results are stored in a TranspositionTable, whose
+// best move is tried first and whose bounds can cut a node off entirely.
+// Repeated positions and the fifty move rule score as draws.
+// The search checks its Clock every few thousand nodes and stops once the
+// time budget is spent, keeping the best move of the last fully searched depth.
+//
+// Several Searches sharing one TranspositionTable can run on different
+// threads at once (Lazy SMP). Each one is given an id, and odd ids search
+// one ply deeper than even ones so that the threads do not all duplicate
+// the same work. A shared stop flag cancels every one of them.
+class Search
+{
+	TranspositionTable& tt_;
+	const atomic<bool>* stop_;
+	uint32_t id_;
+	Position pos_;
+	Clock clock_;
+	Time budget_;
+	uint64_t nodes_;
+	bool stopped_;
+	Move rootBest_;
+	Move bestMove_;
+	int bestScore_;
+	uint32_t depthReached_;
+	array<array<Move, 2>, MAX_PLY> killers_;
+	array<array<array<int, 64>, 64>, 2> history_;
+
+	//
+	int negamax(int depth, int alpha, int beta, int ply);
+
+	//
+	int quiescence(int alpha, int beta, int ply);
+
+	// Gives every Move in list an ordering score.
+	void scoreMoves(const MoveList& list, array<int, 256>& scores, Move hash_move, int ply) const;
+
+	// Stores the Move as a killer and raises its history score.
+	void updateQuietStats(Move move, int depth, int ply);
+
+	// Stops the search if the time budget is spent or the stop flag is set.
+	void checkTime();
+
+	public:
+
+	// Creates a Search that shares the given TranspositionTable.
+	// If stop is not null, setting it cancels a running think().
+	Search(TranspositionTable& tt, const atomic<bool>* stop = nullptr, uint32_t id = 0u);
+
+	// Searches pos until max_depth is reached or budget has elapsed.
+	// The caller should call newSearch() on the table before each search.
+	// Unless cancelled, depth 1 always completes, so a legal move is returned
+	// whenever one exists.
+	// Returns the null Move if the side to move has no legal moves.
+	Move think(const Position& pos, Time budget, uint32_t max_depth = MAX_PLY - 1);
+
+	// Returns the number of nodes visited by the last call to think().
+	uint64_t nodes() const;
+
+	// Returns the score of the last best move, from the side to move's point of view.
+	int score() const;
+
+	// Returns the last depth that was searched completely.
+	uint32_t depth() const;
+};
\ No newline at end of file
@@ -0,0 +1,86 @@
+// Chess
+// TranspositionTable.h
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Header file for the TranspositionTable class.
+
+#pragma once
+
+#include "Move.h"
+
+#include <atomic>
+#include <bit>
+
+// What the search learned about a position the last time it was searched.
+struct TTData
+{
+	Move move;
+	int16_t score;
+	uint8_t depth;
+	uint8_t bound;
+};
+
+// Fixed-size hash table shared by every search thread.
+//
+// Each 64 byte bucket fills exactly one cache line and holds four entries.
+// An entry stores its data word next to (key ^ data), so a probe only
+// accepts it when both words come from the same store. Two threads writing
+// the same entry at once can leave it torn, but a torn entry fails that
+// check and is simply treated as a miss, so no locking is needed.
+class TranspositionTable
+{
+	struct Entry
+	{
+		atomic<uint64_t> check;
+		atomic<uint64_t> data;
+	};
+
+	struct alignas(64) Bucket
+	{
+		array<Entry, 4> entries;
+	};
+
+	vector<Bucket> buckets_;
+	uint64_t mask_;
+	uint8_t generation_;
+
+	public:
+
+	const static uint8_t BOUND_NONE  = 0u;
+	const static uint8_t BOUND_UPPER = 1u;
+	const static uint8_t BOUND_LOWER = 2u;
+	const static uint8_t BOUND_EXACT = 3u;
+
+	// Creates a table of at most size_mb megabytes.
+	TranspositionTable(size_t size_mb);
+
+	TranspositionTable(const TranspositionTable& other) = delete;
+
+	TranspositionTable& operator = (const TranspositionTable& other) = delete;
+
+	~TranspositionTable() = default;
+
+	// Reallocates the table to at most size_mb megabytes and clears it.
+	// The bucket count is rounded down to a power of two. Must not be
+	// called while a search is running.
+	void resize(size_t size_mb);
+
+	// Empties every entry.
+	void clear();
+
+	// Ages every stored entry by one search, making them easier to replace.
+	void newSearch();
+
+	// Returns true and fills data if the position is in the table.
+	bool probe(uint64_t key, TTData& data) const;
+
+	// Stores the result of a search of the position.
+	void store(uint64_t key, Move move, int score, int depth, uint8_t bound);
+
+	// Returns the size of the table in bytes.
+	size_t size() const;
+
+	// Returns how full the table is in permille, from a sample of buckets.
+	int hashfull() const;
+};
\ No newline at end of file
@@ -0,0 +1,64 @@
+// Chess
+// Zobrist.h
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Header file for the Zobrist hashing keys.
+
+#pragma once
+
+#include "Define.h"
+
+// One random key per (Piece ID, square), castling rights combination,
+// en passant file and side to move. The hash key of a Position is the
+// XOR of the keys of everything in it, so a Move updates it with a few XORs.
+struct ZobristKeys
+{
+	array<array<uint64_t, 64>, 12> pieces;
+	array<uint64_t, 16> castling;
+	array<uint64_t, 8> enPassant;
+	uint64_t side;
+};
+
+// Fills the keys at compile time from a fixed seed,
+// so hash keys are identical on every run and every machine.
+constexpr ZobristKeys make_zobrist_keys()
+{
+	ZobristKeys keys {};
+	uint64_t s = 1070372ull;
+
+	auto next = [&s]()
+	{
+		s ^= s >> 12;
+		s ^= s << 25;
+		s ^= s >> 27;
+		return s * 2685821657736338717ull;
+	};
+
+	for (auto& piece : keys.pieces)
+	{
+		for (uint64_t& key : piece)
+			key = next();
+	}
+
+	// The castling keys are the XOR of one key per right,
+	// so that rights can be removed one at a time.
+	array<uint64_t, 4> rights = { next(), next(), next(), next() };
+
+	for (size_t c = 0; c < 16; ++c)
+	{
+		for (size_t r = 0; r < 4; ++r)
+		{
+			if (c & (1ull << r))
+				keys.castling[c] ^= rights[r];
+		}
+	}
+
+	for (uint64_t& key : keys.enPassant)
+		key = next();
+
+	keys.side = next();
+	return keys;
+}
+
+inline constexpr ZobristKeys zobrist = make_zobrist_keys();
\ No newline at end of file
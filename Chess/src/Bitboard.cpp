@@ -0,0 +1,227 @@
+// Chess
+// Bitboard.cpp
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Source file for the Bitboard attack tables.
+
+#include "Bitboard.h"
+
+array<Bitboard, 64> knight_attacks;
+array<Bitboard, 64> king_attacks;
+array<array<Bitboard, 64>, 2> pawn_attacks;
+array<array<Bitboard, 64>, 64> between_bb;
+array<array<Bitboard, 64>, 64> line_bb;
+array<Magic, 64> rook_magics;
+array<Magic, 64> bishop_magics;
+
+// Every relevant occupancy of every square shares these two tables.
+array<Bitboard, 0x19000> rook_table;
+array<Bitboard, 0x1480> bishop_table;
+
+// xorshift64star generator used to search for magic numbers.
+// It is seeded per rank with values known to find magics quickly.
+class MagicRng
+{
+	uint64_t s_;
+
+	public:
+
+	MagicRng(uint64_t seed) : s_(seed) {}
+
+	uint64_t next()
+	{
+		s_ ^= s_ >> 12;
+		s_ ^= s_ << 25;
+		s_ ^= s_ >> 27;
+		return s_ * 2685821657736338717ull;
+	}
+
+	// Returns a number with roughly 1/8th of its bits set.
+	uint64_t sparse()
+	{
+		return next() & next() & next();
+	}
+};
+
+// Returns the squares attacked from sq along the four given directions,
+// stopping at (and including) the first occupied square in each direction.
+Bitboard sliding_attack(const array<array<int, 2>, 4>& directions, uint8_t sq, Bitboard occupied)
+{
+	Bitboard attack = 0;
+
+	for (const auto& d : directions)
+	{
+		int f = file_of(sq) + d[0];
+		int r = rank_of(sq) + d[1];
+
+		while (f >= 0 && f < 8 && r >= 0 && r < 8)
+		{
+			Bitboard b = square_bb(make_square(f, r));
+			attack |= b;
+
+			if (occupied & b)
+				break;
+
+			f += d[0];
+			r += d[1];
+		}
+	}
+
+	return attack;
+}
+
+const array<array<int, 2>, 4> rook_directions = { { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } } };
+const array<array<int, 2>, 4> bishop_directions = { { { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 } } };
+
+// Fills one Magic per square and the shared attack table behind them.
+// Uses the carry-rippler trick to enumerate every subset of each mask.
+void init_magics(Bitboard* table, array<Magic, 64>& magics, const array<array<int, 2>, 4>& directions)
+{
+	const array<uint64_t, 8> seeds = { 728, 10316, 55013, 32803, 12281, 15100, 16645, 255 };
+
+	vector<Bitboard> occupancy(4096);
+	vector<Bitboard> reference(4096);
+	vector<int> epoch(4096, 0);
+	int count = 0;
+	size_t size = 0;
+
+	for (uint8_t sq = 0; sq < 64; ++sq)
+	{
+		Magic& m = magics[sq];
+
+		// Board edges are not part of the mask unless the piece is on them.
+		Bitboard edges = ((RANK_1_BB | RANK_8_BB) & ~(RANK_1_BB << (8 * rank_of(sq))))
+		               | ((FILE_A_BB | FILE_H_BB) & ~(FILE_A_BB << file_of(sq)));
+
+		m.mask = sliding_attack(directions, sq, 0) & ~edges;
+		m.shift = 64 - popcount(m.mask);
+		m.attacks = sq == 0 ? table : magics[sq - 1].attacks + size;
+
+		Bitboard b = 0;
+		size = 0;
+
+		do
+		{
+			occupancy[size] = b;
+			reference[size] = sliding_attack(directions, sq, b);
+
+			#if defined(CHESS_USE_PEXT)
+			m.attacks[_pext_u64(b, m.mask)] = reference[size];
+			#endif
+
+			++size;
+			b = (b - m.mask) & m.mask;
+		} while (b);
+
+		#if defined(CHESS_USE_PEXT)
+		continue;
+		#endif
+
+		MagicRng rng(seeds[rank_of(sq)]);
+
+		for (size_t i = 0; i < size;)
+		{
+			for (m.magic = 0; popcount((m.magic * m.mask) >> 56) < 6;)
+				m.magic = rng.sparse();
+
+			// epoch[] tells which attempt last wrote each slot,
+			// which avoids clearing the table after every failed magic.
+			++count;
+
+			for (i = 0; i < size; ++i)
+			{
+				uint32_t idx = m.index(occupancy[i]);
+
+				if (epoch[idx] < count)
+				{
+					epoch[idx] = count;
+					m.attacks[idx] = reference[i];
+				}
+				else if (m.attacks[idx] != reference[i])
+					break;
+			}
+		}
+	}
+}
+
+void init_bitboards()
+{
+	const array<array<int, 2>, 8> knight_steps = { { { 1, 2 }, { 2, 1 }, { 2, -1 }, { 1, -2 }, { -1, -2 }, { -2, -1 }, { -2, 1 }, { -1, 2 } } };
+	const array<array<int, 2>, 8> king_steps = { { { 1, 0 }, { 1, 1 }, { 0, 1 }, { -1, 1 }, { -1, 0 }, { -1, -1 }, { 0, -1 }, { 1, -1 } } };
+
+	for (uint8_t sq = 0; sq < 64; ++sq)
+	{
+		int f = file_of(sq);
+		int r = rank_of(sq);
+
+		knight_attacks[sq] = 0;
+		king_attacks[sq] = 0;
+		pawn_attacks[WHITE][sq] = 0;
+		pawn_attacks[BLACK][sq] = 0;
+
+		for (const auto& d : knight_steps)
+		{
+			if (f + d[0] >= 0 && f + d[0] < 8 && r + d[1] >= 0 && r + d[1] < 8)
+				knight_attacks[sq] |= square_bb(make_square(f + d[0], r + d[1]));
+		}
+
+		for (const auto& d : king_steps)
+		{
+			if (f + d[0] >= 0 && f + d[0] < 8 && r + d[1] >= 0 && r + d[1] < 8)
+				king_attacks[sq] |= square_bb(make_square(f + d[0], r + d[1]));
+		}
+
+		for (int df = -1; df <= 1; df += 2)
+		{
+			if (f + df < 0 || f + df > 7)
+				continue;
+
+			if (r < 7)
+				pawn_attacks[WHITE][sq] |= square_bb(make_square(f + df, r + 1));
+			if (r > 0)
+				pawn_attacks[BLACK][sq] |= square_bb(make_square(f + df, r - 1));
+		}
+	}
+
+	init_magics(rook_table.data(), rook_magics, rook_directions);
+	init_magics(bishop_table.data(), bishop_magics, bishop_directions);
+
+	for (uint8_t a = 0; a < 64; ++a)
+	{
+		for (uint8_t b = 0; b < 64; ++b)
+		{
+			between_bb[a][b] = 0;
+			line_bb[a][b] = 0;
+
+			if (a == b)
+				continue;
+
+			if (rook_attacks(a, 0) & square_bb(b))
+			{
+				line_bb[a][b] = (rook_attacks(a, 0) & rook_attacks(b, 0)) | square_bb(a) | square_bb(b);
+				between_bb[a][b] = rook_attacks(a, square_bb(b)) & rook_attacks(b, square_bb(a));
+			}
+			else if (bishop_attacks(a, 0) & square_bb(b))
+			{
+				line_bb[a][b] = (bishop_attacks(a, 0) & bishop_attacks(b, 0)) | square_bb(a) | square_bb(b);
+				between_bb[a][b] = bishop_attacks(a, square_bb(b)) & bishop_attacks(b, square_bb(a));
+			}
+		}
+	}
+}
+
+string bitboard_to_string(Bitboard b)
+{
+	string str;
+
+	for (int r = 7; r >= 0; --r)
+	{
+		for (int f = 0; f < 8; ++f)
+			str += (b & square_bb(make_square(f, r))) ? "X " : ". ";
+
+		str += '\n';
+	}
+
+	return str;
+}
\ No newline at end of file
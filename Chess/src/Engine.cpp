@@ -0,0 +1,121 @@
+// Chess
+// Engine.cpp
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Source file for the Engine class.
+
+#include "Engine.h"
+
+void Engine::join()
+{
+	for (thread& th : threads_)
+	{
+		if (th.joinable())
+			th.join();
+	}
+
+	threads_.clear();
+}
+
+Engine::Engine(uint32_t thread_count, size_t hash_size_mb)
+	: tt_(hash_size_mb), stop_(false), finished_(false), best_(0u)
+{
+	if (thread_count == 0u)
+		thread_count = max(thread::hardware_concurrency(), 1u);
+
+	searches_.reserve(thread_count);
+
+	for (uint32_t i = 0; i < thread_count; ++i)
+		searches_.push_back(make_unique<Search>(tt_, &stop_, i));
+
+	moves_.resize(thread_count);
+}
+
+Engine::~Engine()
+{
+	stop();
+}
+
+void Engine::start(const Position& pos, Time budget)
+{
+	stop();
+
+	stop_ = false;
+	finished_ = false;
+	best_ = 0u;
+	tt_.newSearch();
+
+	// Every thread gets its own copy of the Position, since the
+	// caller is free to change theirs while the search runs.
+	for (size_t i = 1; i < searches_.size(); ++i)
+	{
+		threads_.emplace_back([this, i, pos, budget]()
+		{
+			moves_[i] = searches_[i]->think(pos, budget);
+		});
+	}
+
+	threads_.emplace_back([this, pos, budget]()
+	{
+		moves_[0] = searches_[0]->think(pos, budget);
+		stop_ = true;
+		finished_ = true;
+	});
+}
+
+void Engine::stop()
+{
+	stop_ = true;
+	join();
+	finished_ = false;
+}
+
+bool Engine::busy() const
+{
+	return !threads_.empty();
+}
+
+bool Engine::result(Move& move)
+{
+	if (threads_.empty() || !finished_)
+		return false;
+
+	// The helpers see the stop flag within a few thousand nodes.
+	join();
+	finished_ = false;
+
+	for (size_t i = 1; i < searches_.size(); ++i)
+	{
+		if (searches_[i]->depth() > searches_[best_]->depth() && !moves_[i].isNull())
+			best_ = i;
+	}
+
+	move = moves_[best_];
+	return true;
+}
+
+uint32_t Engine::threadCount() const
+{
+	return static_cast<uint32_t>(searches_.size());
+}
+
+uint64_t Engine::nodes() const
+{
+	uint64_t total = 0u;
+
+	for (const unique_ptr<Search>& search : searches_)
+		total += search->nodes();
+
+	return total;
+}
+
+int Engine::score() const
+{
+	return searches_[best_]->score();
+}
+
+uint32_t Engine::depth() const
+{
+	return searches_[best_]->depth();
+}
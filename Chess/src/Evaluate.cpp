@@ -0,0 +1,145 @@
+// Chess
+// Evaluate.cpp
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Source file for the static evaluation.
+
+#include "Evaluate.h"
+
+// Piece-square tables from white's point of view, laid out as the board
+// is drawn: a8 is the first entry and h1 the last.
+typedef array<int, 64> PieceSquareTable;
+
+const PieceSquareTable pawn_table =
+{
+	 0,  0,  0,  0,  0,  0,  0,  0,
+	50, 50, 50, 50, 50, 50, 50, 50,
+	10, 10, 20, 30, 30, 20, 10, 10,
+	 5,  5, 10, 25, 25, 10,  5,  5,
+	 0,  0,  0, 20, 20,  0,  0,  0,
+	 5, -5,-10,  0,  0,-10, -5,  5,
+	 5, 10, 10,-20,-20, 10, 10,  5,
+	 0,  0,  0,  0,  0,  0,  0,  0
+};
+
+const PieceSquareTable rook_table =
+{
+	 0,  0,  0,  0,  0,  0,  0,  0,
+	 5, 10, 10, 10, 10, 10, 10,  5,
+	-5,  0,  0,  0,  0,  0,  0, -5,
+	-5,  0,  0,  0,  0,  0,  0, -5,
+	-5,  0,  0,  0,  0,  0,  0, -5,
+	-5,  0,  0,  0,  0,  0,  0, -5,
+	-5,  0,  0,  0,  0,  0,  0, -5,
+	 0,  0,  0,  5,  5,  0,  0,  0
+};
+
+const PieceSquareTable knight_table =
+{
+	-50,-40,-30,-30,-30,-30,-40,-50,
+	-40,-20,  0,  0,  0,  0,-20,-40,
+	-30,  0, 10, 15, 15, 10,  0,-30,
+	-30,  5, 15, 20, 20, 15,  5,-30,
+	-30,  0, 15, 20, 20, 15,  0,-30,
+	-30,  5, 10, 15, 15, 10,  5,-30,
+	-40,-20,  0,  5,  5,  0,-20,-40,
+	-50,-40,-30,-30,-30,-30,-40,-50
+};
+
+const PieceSquareTable bishop_table =
+{
+	-20,-10,-10,-10,-10,-10,-10,-20,
+	-10,  0,  0,  0,  0,  0,  0,-10,
+	-10,  0,  5, 10, 10,  5,  0,-10,
+	-10,  5,  5, 10, 10,  5,  5,-10,
+	-10,  0, 10, 10, 10, 10,  0,-10,
+	-10, 10, 10, 10, 10, 10, 10,-10,
+	-10,  5,  0,  0,  0,  0,  5,-10,
+	-20,-10,-10,-10,-10,-10,-10,-20
+};
+
+const PieceSquareTable queen_table =
+{
+	-20,-10,-10, -5, -5,-10,-10,-20,
+	-10,  0,  0,  0,  0,  0,  0,-10,
+	-10,  0,  5,  5,  5,  5,  0,-10,
+	 -5,  0,  5,  5,  5,  5,  0, -5,
+	  0,  0,  5,  5,  5,  5,  0, -5,
+	-10,  5,  5,  5,  5,  5,  0,-10,
+	-10,  0,  5,  0,  0,  0,  0,-10,
+	-20,-10,-10, -5, -5,-10,-10,-20
+};
+
+const PieceSquareTable king_middlegame_table =
+{
+	-30,-40,-40,-50,-50,-40,-40,-30,
+	-30,-40,-40,-50,-50,-40,-40,-30,
+	-30,-40,-40,-50,-50,-40,-40,-30,
+	-30,-40,-40,-50,-50,-40,-40,-30,
+	-20,-30,-30,-40,-40,-30,-30,-20,
+	-10,-20,-20,-20,-20,-20,-20,-10,
+	 20, 20,  0,  0,  0,  0, 20, 20,
+	 20, 30, 10,  0,  0, 10, 30, 20
+};
+
+const PieceSquareTable king_endgame_table =
+{
+	-50,-40,-30,-20,-20,-30,-40,-50,
+	-30,-20,-10,  0,  0,-10,-20,-30,
+	-30,-10, 20, 30, 30, 20,-10,-30,
+	-30,-10, 30, 40, 40, 30,-10,-30,
+	-30,-10, 30, 40, 40, 30,-10,-30,
+	-30,-10, 20, 30, 30, 20,-10,-30,
+	-30,-30,  0,  0,  0,  0,-30,-30,
+	-50,-30,-30,-30,-30,-30,-30,-50
+};
+
+// Indexed by white Piece ID. The king is handled separately.
+const array<const PieceSquareTable*, 5> piece_tables =
+{
+	&pawn_table, &rook_table, &knight_table, &bishop_table, &queen_table
+};
+
+// Game phase weight of each piece type. The full starting material adds up to 24.
+const array<int, 6> phase_weights = { 0, 2, 1, 1, 4, 0 };
+
+int evaluate(const Position& pos)
+{
+	array<int, 2> score = { 0, 0 };
+	int phase = 0;
+
+	for (uint8_t type = Piece::WHITE_PAWN; type < Piece::WHITE_KING; ++type)
+	{
+		const PieceSquareTable& table = *piece_tables[type];
+
+		for (uint8_t color = WHITE; color <= BLACK; ++color)
+		{
+			Bitboard b = pos.pieces(make_piece(color, type));
+
+			phase += phase_weights[type] * popcount(b);
+			score[color] += piece_values[type] * popcount(b);
+
+			// The tables are drawn from white's side, so white squares are
+			// mirrored vertically and black squares are used as they are.
+			while (b)
+			{
+				uint8_t sq = pop_lsb(b);
+				score[color] += table[color == WHITE ? sq ^ 56u : sq];
+			}
+		}
+	}
+
+	phase = min(phase, 24);
+
+	for (uint8_t color = WHITE; color <= BLACK; ++color)
+	{
+		uint8_t sq = pos.kingSquare(color);
+		uint8_t idx = color == WHITE ? sq ^ 56u : sq;
+
+		score[color] += (king_middlegame_table[idx] * phase + king_endgame_table[idx] * (24 - phase)) / 24;
+	}
+
+	uint8_t us = pos.sideToMove();
+	return score[us] - score[us ^ 1u];
+}
\ No newline at end of file
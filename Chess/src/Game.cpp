@@ -2,11 +2,33 @@
 // Game.cpp
 // Justyn Durnford
 // Created on 2021-05-16
-// Last modified on 2021-05-17
+// Last modified on 2026-10-17
 // Source file for the Game class.
 
 #include "Game.h"
 
+#include <iomanip>
+
+// Time the engine may think per move. The search runs on its own threads,
+// so this does not hold up events or rendering.
+const Time engine_budget = seconds(1.f);
+
+// While the player thinks, the engine analyses the position to fill the
+// transposition table. The analysis is cancelled as soon as the player moves.
+const Time analysis_budget = seconds(600.f);
+
+// Number of search threads. 0 uses one per core.
+const uint32_t engine_threads = 0u;
+
+// Size of the engine's transposition table.
+const size_t hash_size_mb = 64u;
+
+// Average time of one frame in milliseconds.
+inline double per_frame_ms(Time total, uint64_t frames)
+{
+	return frames == 0u ? 0.0 : total.asMicroseconds() / 1000.0 / frames;
+}
+
 void Game::processEvents()
 {
 	while (window_.pollEvent(event_))
@@ -25,6 +47,11 @@ void Game::processEvents()
 				handleKeyboardInput(event_.key.code, false);
 				break;
 
+			case Event::MouseButtonPressed:
+				if (event_.mouseButton.button == Mouse::Button::Left)
+					handleMouseInput(event_.mouseButton.x, event_.mouseButton.y);
+				break;
+
 			default:
 				break;
 		}
@@ -55,18 +82,128 @@ void Game::handleKeyboardInput(Keyboard::Key key, bool is_pressed)
 	}
 }
 
+void Game::handleMouseInput(int x, int y)
+{
+	if (position_.sideToMove() == engineColor_)
+		return;
+
+	// The board fills the window with white at the bottom.
+	Vector2u size = window_.getSize();
+	int file = x * 8 / static_cast<int>(size.x);
+	int rank = 7 - y * 8 / static_cast<int>(size.y);
+
+	if (file < 0 || file > 7 || rank < 0 || rank > 7)
+		return;
+
+	uint8_t square = make_square(static_cast<uint8_t>(file), static_cast<uint8_t>(rank));
+	uint8_t piece = position_.pieceOn(square);
+
+	if (piece != NO_PIECE && piece_color(piece) == position_.sideToMove())
+	{
+		selected_ = square;
+		return;
+	}
+
+	if (selected_ == NO_SQUARE)
+		return;
+
+	MoveList list;
+	generate_legal_moves(position_, list);
+
+	for (Move move : list)
+	{
+		// Pawns always promote to a queen.
+		if (move.from() == selected_ && move.to() == square
+			&& (!move.isPromotion() || move.promotionType() == Piece::WHITE_QUEEN))
+		{
+			playerMove(move);
+			break;
+		}
+	}
+
+	selected_ = NO_SQUARE;
+}
+
+void Game::playerMove(Move move)
+{
+	// Cancel the analysis of the position the player just left.
+	engine_.stop();
+	position_.makeMove(move);
+}
+
 void Game::update(Time dt)
 {
+	Move move;
+
+	if (engine_.result(move))
+	{
+		// Analysis results are only used to warm the table.
+		if (position_.sideToMove() == engineColor_ && !move.isNull())
+			position_.makeMove(move);
+	}
+
+	// Each position is searched once; finished analysis is not restarted.
+	if (!engine_.busy() && position_.key() != searchedKey_)
+	{
+		searchedKey_ = position_.key();
+
+		MoveList list;
+		generate_legal_moves(position_, list);
+
+		if (list.empty())
+			return;
 
+		if (position_.sideToMove() == engineColor_)
+			engine_.start(position_, engine_budget);
+		else
+			engine_.start(position_, analysis_budget);
+	}
 }
 
 void Game::render()
 {
+	// The board fills the window with white at the bottom, as in handleMouseInput().
+	Vector2f size(window_.getSize());
+	Vector2f cell(size.x / 8.f, size.y / 8.f);
+
+	window_.clear();
+
+	Sprite board(textures[12]);
+	Vector2f board_size(textures[12].getSize());
+	board.setScale(size.x / board_size.x, size.y / board_size.y);
+	window_.draw(board);
+
+	if (selected_ != NO_SQUARE)
+	{
+		RectangleShape highlight(cell);
+		highlight.setPosition(file_of(selected_) * cell.x, (7 - rank_of(selected_)) * cell.y);
+		highlight.setFillColor(Color(255, 255, 0, 96));
+		window_.draw(highlight);
+	}
+
+	for (uint8_t sq = 0; sq < 64; ++sq)
+	{
+		uint8_t piece = position_.pieceOn(sq);
+
+		if (piece == NO_PIECE)
+			continue;
+
+		Sprite sprite = piece < 6 ? white_pieces[piece].sprite() : black_pieces[piece - 6].sprite();
+		Vector2f texture_size(sprite.getTexture()->getSize());
+		sprite.setScale(cell.x / texture_size.x, cell.y / texture_size.y);
+		sprite.setPosition(file_of(sq) * cell.x, (7 - rank_of(sq)) * cell.y);
+		window_.draw(sprite);
+	}
 
+	window_.display();
 }
 
 Game::Game(uint32_t width, uint32_t height)
-	: window_(VideoMode(width, height), "Spaceship Game", Style::Titlebar | Style::Close)
+	: window_(VideoMode(width, height), "Chess", Style::Titlebar | Style::Close),
+	  engine_(engine_threads, hash_size_mb),
+	  engineColor_(BLACK),
+	  selected_(NO_SQUARE),
+	  searchedKey_(0u)
 {
 	keyboardInput_[Keyboard::Key::W] = false;
 	keyboardInput_[Keyboard::Key::A] = false;
@@ -79,11 +216,46 @@ Game::Game(uint32_t width, uint32_t height)
 void Game::run()
 {
 	Clock clock;
+	Clock phase_clock;
+	Time accumulator = Time::Zero;
+	const Time max_accumulator = time_step * static_cast<Int64>(max_steps_per_frame);
 
 	while (window_.isOpen())
 	{
+		accumulator += clock.restart();
+
+		if (accumulator > max_accumulator)
+		{
+			times_.droppedSteps += (accumulator - max_accumulator).asMicroseconds() / time_step.asMicroseconds();
+			accumulator = max_accumulator;
+		}
+
+		phase_clock.restart();
 		processEvents();
-		update(clock.restart());
+		times_.events += phase_clock.restart();
+
+		while (accumulator >= time_step)
+		{
+			update(time_step);
+			accumulator -= time_step;
+			++times_.steps;
+		}
+
+		times_.update += phase_clock.restart();
+
+		// Nothing on the board moves between steps, so there is nothing to blend.
 		render();
+		times_.render += phase_clock.restart();
+		++times_.frames;
 	}
+
+	cout << fixed << setprecision(3)
+	     << "Frames: " << times_.frames << ", steps: " << times_.steps
+	     << ", dropped steps: " << times_.droppedSteps << endl
+	     << "Per frame: events " << per_frame_ms(times_.events, times_.frames) << " ms, update "
+	     << per_frame_ms(times_.update, times_.frames) << " ms, render "
+	     << per_frame_ms(times_.render, times_.frames) << " ms" << endl;
+
+	// Do not leave search threads running once the window is gone.
+	engine_.stop();
 }
\ No newline at end of file
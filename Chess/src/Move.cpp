@@ -0,0 +1,45 @@
+// Chess
+// Move.cpp
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Source file for the Move and MoveList classes.
+
+#include "Move.h"
+#include "Piece.h"
+
+uint8_t Move::promotionType() const
+{
+	switch (flags() & 3u)
+	{
+		case 0u: return Piece::WHITE_KNIGHT;
+		case 1u: return Piece::WHITE_BISHOP;
+		case 2u: return Piece::WHITE_ROOK;
+		default: return Piece::WHITE_QUEEN;
+	}
+}
+
+string Move::toString() const
+{
+	string str;
+	str += static_cast<char>('a' + (from() & 7u));
+	str += static_cast<char>('1' + (from() >> 3));
+	str += static_cast<char>('a' + (to() & 7u));
+	str += static_cast<char>('1' + (to() >> 3));
+
+	if (isPromotion())
+		str += "nbrq"[flags() & 3u];
+
+	return str;
+}
+
+bool MoveList::contains(Move move) const
+{
+	for (size_t i = 0; i < size_; ++i)
+	{
+		if (moves_[i] == move)
+			return true;
+	}
+
+	return false;
+}
\ No newline at end of file
@@ -0,0 +1,202 @@
+// Chess
+// MoveGen.cpp
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Source file for the legal move generator.
+
+#include "MoveGen.h"
+
+// Appends a Move from the given square to every square in targets.
+inline void add_moves(uint8_t from, Bitboard targets, Bitboard enemy, MoveList& list)
+{
+	while (targets)
+	{
+		uint8_t to = pop_lsb(targets);
+		list.push_back(Move(from, to, (enemy & square_bb(to)) ? Move::CAPTURE : Move::QUIET));
+	}
+}
+
+// Appends the promotions of one pawn move.
+// Only the queen promotion is generated when CapturesOnly is set.
+template <bool CapturesOnly>
+inline void add_promotions(uint8_t from, uint8_t to, bool capture, MoveList& list)
+{
+	uint8_t base = capture ? Move::CAPTURE_KNIGHT : Move::PROMOTE_KNIGHT;
+
+	list.push_back(Move(from, to, base + 3u));
+
+	if (!CapturesOnly)
+	{
+		list.push_back(Move(from, to, base));
+		list.push_back(Move(from, to, base + 1u));
+		list.push_back(Move(from, to, base + 2u));
+	}
+}
+
+// Generates legal Moves directly rather than filtering pseudo-legal ones:
+//  - the king only steps to squares that stay unattacked once it has moved,
+//  - in single check the other pieces must capture the checker or block,
+//  - pinned pieces stay on the line between their king and the pinner,
+//  - en passant is tested on the resulting occupancy, which also covers
+//    the case of both pawns leaving a rank shared with the king.
+template <bool CapturesOnly>
+void generate(const Position& pos, MoveList& list)
+{
+	uint8_t us = pos.sideToMove();
+	uint8_t them = us ^ 1u;
+	Bitboard own = pos.colorPieces(us);
+	Bitboard enemy = pos.colorPieces(them);
+	Bitboard occupied = own | enemy;
+	uint8_t ksq = pos.kingSquare(us);
+	Bitboard checkers = pos.attackersTo(ksq, occupied) & enemy;
+
+	// King moves.
+	Bitboard king_targets = king_attacks[ksq] & (CapturesOnly ? enemy : ~own);
+	Bitboard without_king = occupied ^ square_bb(ksq);
+
+	while (king_targets)
+	{
+		uint8_t to = pop_lsb(king_targets);
+
+		if (!(pos.attackersTo(to, without_king) & enemy))
+			list.push_back(Move(ksq, to, (enemy & square_bb(to)) ? Move::CAPTURE : Move::QUIET));
+	}
+
+	// In double check only the king can move.
+	if (more_than_one(checkers))
+		return;
+
+	Bitboard target = checkers ? (between_bb[ksq][lsb(checkers)] | checkers) : ~own;
+	Bitboard piece_target = CapturesOnly ? (target & enemy) : target;
+
+	Bitboard their_diagonal = pos.pieces(make_piece(them, Piece::WHITE_BISHOP)) | pos.pieces(make_piece(them, Piece::WHITE_QUEEN));
+	Bitboard their_straight = pos.pieces(make_piece(them, Piece::WHITE_ROOK)) | pos.pieces(make_piece(them, Piece::WHITE_QUEEN));
+
+	// A piece is pinned if it is the only piece between the king and an enemy slider.
+	Bitboard pinned = 0;
+	Bitboard snipers = (rook_attacks(ksq, 0) & their_straight) | (bishop_attacks(ksq, 0) & their_diagonal);
+
+	while (snipers)
+	{
+		Bitboard b = between_bb[ksq][pop_lsb(snipers)] & occupied;
+
+		if (b && !more_than_one(b))
+			pinned |= b & own;
+	}
+
+	// Knights. A pinned knight can never move.
+	Bitboard knights = pos.pieces(make_piece(us, Piece::WHITE_KNIGHT)) & ~pinned;
+
+	while (knights)
+	{
+		uint8_t from = pop_lsb(knights);
+		add_moves(from, knight_attacks[from] & piece_target, enemy, list);
+	}
+
+	// Bishops, rooks and queens. Queens appear in both sets.
+	Bitboard diagonal = pos.pieces(make_piece(us, Piece::WHITE_BISHOP)) | pos.pieces(make_piece(us, Piece::WHITE_QUEEN));
+	Bitboard straight = pos.pieces(make_piece(us, Piece::WHITE_ROOK)) | pos.pieces(make_piece(us, Piece::WHITE_QUEEN));
+
+	while (diagonal)
+	{
+		uint8_t from = pop_lsb(diagonal);
+		Bitboard b = bishop_attacks(from, occupied) & piece_target;
+
+		if (pinned & square_bb(from))
+			b &= line_bb[ksq][from];
+
+		add_moves(from, b, enemy, list);
+	}
+
+	while (straight)
+	{
+		uint8_t from = pop_lsb(straight);
+		Bitboard b = rook_attacks(from, occupied) & piece_target;
+
+		if (pinned & square_bb(from))
+			b &= line_bb[ksq][from];
+
+		add_moves(from, b, enemy, list);
+	}
+
+	// Pawns.
+	Bitboard pawns = pos.pieces(make_piece(us, Piece::WHITE_PAWN));
+	Bitboard promotion_rank = us == WHITE ? RANK_7_BB : RANK_2_BB;
+	Bitboard double_rank = us == WHITE ? RANK_2_BB : RANK_7_BB;
+	Bitboard empty = ~occupied;
+	uint8_t ep = pos.epSquare();
+
+	while (pawns)
+	{
+		uint8_t from = pop_lsb(pawns);
+		Bitboard from_bb = square_bb(from);
+		Bitboard allowed = (pinned & from_bb) ? line_bb[ksq][from] : ~0ull;
+
+		Bitboard single = pawn_push(from_bb, us) & empty;
+		Bitboard captures = pawn_attacks[us][from] & enemy & target & allowed;
+
+		if (from_bb & promotion_rank)
+		{
+			single &= target & allowed;
+
+			if (single)
+				add_promotions<CapturesOnly>(from, lsb(single), false, list);
+
+			while (captures)
+				add_promotions<CapturesOnly>(from, pop_lsb(captures), true, list);
+		}
+		else
+		{
+			while (captures)
+				list.push_back(Move(from, pop_lsb(captures), Move::CAPTURE));
+
+			if (!CapturesOnly)
+			{
+				Bitboard twice = (from_bb & double_rank) ? (pawn_push(single, us) & empty & target & allowed) : 0;
+				single &= target & allowed;
+
+				if (single)
+					list.push_back(Move(from, lsb(single), Move::QUIET));
+				if (twice)
+					list.push_back(Move(from, lsb(twice), Move::DOUBLE_PUSH));
+			}
+		}
+
+		if (ep != NO_SQUARE && (pawn_attacks[us][from] & square_bb(ep)))
+		{
+			uint8_t cap_sq = us == WHITE ? ep - 8 : ep + 8;
+			Bitboard after = (occupied ^ from_bb ^ square_bb(cap_sq)) | square_bb(ep);
+			Bitboard attackers = pos.attackersTo(ksq, after) & enemy & ~square_bb(cap_sq);
+
+			if (!attackers)
+				list.push_back(Move(from, ep, Move::EN_PASSANT));
+		}
+	}
+
+	// Castling. The rights guarantee the king and rook are still on their squares.
+	if (CapturesOnly || checkers)
+		return;
+
+	uint8_t rights = pos.castlingRights();
+	uint8_t oo = us == WHITE ? Position::WHITE_OO : Position::BLACK_OO;
+	uint8_t ooo = us == WHITE ? Position::WHITE_OOO : Position::BLACK_OOO;
+
+	if ((rights & oo) && !(occupied & (square_bb(ksq + 1) | square_bb(ksq + 2)))
+		&& !pos.isAttacked(ksq + 1, them) && !pos.isAttacked(ksq + 2, them))
+		list.push_back(Move(ksq, ksq + 2, Move::KING_CASTLE));
+
+	if ((rights & ooo) && !(occupied & (square_bb(ksq - 1) | square_bb(ksq - 2) | square_bb(ksq - 3)))
+		&& !pos.isAttacked(ksq - 1, them) && !pos.isAttacked(ksq - 2, them))
+		list.push_back(Move(ksq, ksq - 2, Move::QUEEN_CASTLE));
+}
+
+void generate_legal_moves(const Position& pos, MoveList& list)
+{
+	generate<false>(pos, list);
+}
+
+void generate_legal_captures(const Position& pos, MoveList& list)
+{
+	generate<true>(pos, list);
+}
\ No newline at end of file
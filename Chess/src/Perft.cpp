@@ -0,0 +1,92 @@
+// Chess
+// Perft.cpp
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Source file for the perft node counters.
+
+#include "Perft.h"
+
+#include <atomic>
+#include <thread>
+
+uint64_t perft(Position& pos, uint32_t depth)
+{
+	if (depth == 0)
+		return 1;
+
+	MoveList list;
+	generate_legal_moves(pos, list);
+
+	if (depth == 1)
+		return list.size();
+
+	uint64_t nodes = 0;
+
+	for (Move move : list)
+	{
+		pos.makeMove(move);
+		nodes += perft(pos, depth - 1);
+		pos.unmakeMove(move);
+	}
+
+	return nodes;
+}
+
+vector<PerftEntry> perft_divide(const Position& pos, uint32_t depth, uint32_t thread_count)
+{
+	MoveList list;
+	generate_legal_moves(pos, list);
+
+	vector<PerftEntry> entries(list.size());
+
+	if (depth == 0 || list.empty())
+		return entries;
+
+	// Root Moves are handed out one at a time, so a thread that
+	// draws a small subtree simply moves on to the next one.
+	atomic<size_t> next(0);
+
+	auto work = [&]()
+	{
+		Position copy(pos);
+
+		for (size_t i = next++; i < list.size(); i = next++)
+		{
+			copy.makeMove(list[i]);
+			entries[i] = { list[i], perft(copy, depth - 1) };
+			copy.unmakeMove(list[i]);
+		}
+	};
+
+	thread_count = clamp<uint32_t>(thread_count, 1u, static_cast<uint32_t>(list.size()));
+
+	vector<thread> threads;
+	threads.reserve(thread_count - 1);
+
+	for (uint32_t t = 1; t < thread_count; ++t)
+		threads.emplace_back(work);
+
+	work();
+
+	for (thread& th : threads)
+		th.join();
+
+	return entries;
+}
+
+uint64_t perft_parallel(const Position& pos, uint32_t depth, uint32_t thread_count)
+{
+	if (depth <= 1 || thread_count <= 1)
+	{
+		Position copy(pos);
+		return perft(copy, depth);
+	}
+
+	uint64_t nodes = 0;
+
+	for (const PerftEntry& entry : perft_divide(pos, depth, thread_count))
+		nodes += entry.nodes;
+
+	return nodes;
+}
\ No newline at end of file
@@ -2,7 +2,7 @@
 // Piece.cpp
 // Justyn Durnford
 // Created on 2021-05-17
-// Last modified on 2021-05-17
+// Last modified on 2026-10-17
 // Source file for the Piece class.
 
 #include "Piece.h"
@@ -12,7 +12,6 @@ Piece::Piece()
 	id_ = 0;
 	name_ = "";
 	texturePtr_ = nullptr;
-	sprite_.setTexture(*texturePtr_);
 }
 
 Piece::Piece(uint8_t id, strref name, Texture* texturePtr)
@@ -33,7 +32,8 @@ Piece::Piece(Piece&& other) noexcept
 	texturePtr_ = other.texturePtr_;
 	other.texturePtr_ = nullptr;
 
-	sprite_.setTexture(*texturePtr_);
+	if (texturePtr_ != nullptr)
+		sprite_.setTexture(*texturePtr_);
 }
 
 Piece& Piece::operator = (Piece&& other) noexcept
@@ -46,7 +46,8 @@ Piece& Piece::operator = (Piece&& other) noexcept
 	texturePtr_ = other.texturePtr_;
 	other.texturePtr_ = nullptr;
 
-	sprite_.setTexture(*texturePtr_);
+	if (texturePtr_ != nullptr)
+		sprite_.setTexture(*texturePtr_);
 
 	return *this;
 }
@@ -0,0 +1,463 @@
+// Chess
+// Position.cpp
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-17
+// Source file for the Position class.
+
+#include "MoveGen.h"
+
+#include <charconv>
+
+// Castling rights that survive a Move touching each square.
+// Moving a king or rook, or capturing a rook, clears the matching rights.
+const array<uint8_t, 64> castling_mask = []
+{
+	array<uint8_t, 64> mask;
+	mask.fill(15u);
+	mask[0]  = static_cast<uint8_t>(~Position::WHITE_OOO & 15u);
+	mask[4]  = static_cast<uint8_t>(~(Position::WHITE_OO | Position::WHITE_OOO) & 15u);
+	mask[7]  = static_cast<uint8_t>(~Position::WHITE_OO & 15u);
+	mask[56] = static_cast<uint8_t>(~Position::BLACK_OOO & 15u);
+	mask[60] = static_cast<uint8_t>(~(Position::BLACK_OO | Position::BLACK_OOO) & 15u);
+	mask[63] = static_cast<uint8_t>(~Position::BLACK_OO & 15u);
+	return mask;
+}();
+
+const string piece_chars = "PRNBQKprnbqk";
+
+void Position::putPiece(uint8_t piece, uint8_t sq)
+{
+	Bitboard b = square_bb(sq);
+	board_[sq] = piece;
+	pieces_[piece] |= b;
+	colors_[piece_color(piece)] |= b;
+}
+
+void Position::removePiece(uint8_t sq)
+{
+	Bitboard b = square_bb(sq);
+	uint8_t piece = board_[sq];
+	board_[sq] = NO_PIECE;
+	pieces_[piece] ^= b;
+	colors_[piece_color(piece)] ^= b;
+}
+
+void Position::movePiece(uint8_t from, uint8_t to)
+{
+	Bitboard b = square_bb(from) | square_bb(to);
+	uint8_t piece = board_[from];
+	board_[from] = NO_PIECE;
+	board_[to] = piece;
+	pieces_[piece] ^= b;
+	colors_[piece_color(piece)] ^= b;
+}
+
+Position::Position()
+{
+	setFEN(start_fen);
+}
+
+Position::Position(strref fen)
+{
+	setFEN(fen);
+}
+
+void Position::clear()
+{
+	pieces_.fill(0);
+	colors_.fill(0);
+	board_.fill(NO_PIECE);
+	sideToMove_ = WHITE;
+	fullmoveNumber_ = 1u;
+	state_ = { 0u, NO_SQUARE, 0u, NO_PIECE, 0u };
+	history_.clear();
+	history_.reserve(256);
+}
+
+bool Position::setFEN(strref fen)
+{
+	clear();
+
+	size_t i = 0;
+	int file = 0;
+	int rank = 7;
+
+	// Piece placement.
+	for (; i < fen.size() && fen[i] != ' '; ++i)
+	{
+		char c = fen[i];
+
+		if (c == '/')
+		{
+			--rank;
+			file = 0;
+		}
+		else if (c >= '1' && c <= '8')
+			file += c - '0';
+		else
+		{
+			size_t p = piece_chars.find(c);
+
+			if (p == string::npos || file > 7 || rank < 0)
+			{
+				clear();
+				return false;
+			}
+
+			putPiece(static_cast<uint8_t>(p), make_square(file, rank));
+			++file;
+		}
+	}
+
+	if (popcount(pieces_[Piece::WHITE_KING]) != 1 || popcount(pieces_[Piece::BLACK_KING]) != 1)
+	{
+		clear();
+		return false;
+	}
+
+	// Side to move.
+	if (++i < fen.size())
+		sideToMove_ = fen[i] == 'b' ? BLACK : WHITE;
+
+	// Castling rights.
+	for (i += 2; i < fen.size() && fen[i] != ' '; ++i)
+	{
+		switch (fen[i])
+		{
+			case 'K': state_.castling |= WHITE_OO;  break;
+			case 'Q': state_.castling |= WHITE_OOO; break;
+			case 'k': state_.castling |= BLACK_OO;  break;
+			case 'q': state_.castling |= BLACK_OOO; break;
+			default: break;
+		}
+	}
+
+	// Drop any right whose king or rook is not on its original square.
+	for (uint8_t sq : { 0, 4, 7, 56, 60, 63 })
+	{
+		uint8_t expected = (sq == 4 || sq == 60) ? Piece::WHITE_KING : Piece::WHITE_ROOK;
+
+		if (board_[sq] != make_piece(sq < 8 ? WHITE : BLACK, expected))
+			state_.castling &= castling_mask[sq];
+	}
+
+	// En passant square.
+	if (++i + 1 < fen.size() && fen[i] >= 'a' && fen[i] <= 'h')
+	{
+		uint8_t ep = make_square(fen[i] - 'a', fen[i + 1] - '1');
+		uint8_t us = sideToMove_;
+
+		// Only keep it if a pawn could actually capture there,
+		// so that identical positions compare equal.
+		if (ep < 64 && (pawn_attacks[us ^ 1u][ep] & pieces_[make_piece(us, Piece::WHITE_PAWN)]))
+			state_.epSquare = ep;
+
+		++i;
+	}
+
+	// Move counters. Either may be missing, in which case clear() has already
+	// left them at 0 and 1, but one that is there must be a number. The fields
+	// above step past short FENs such as "... w" or "... w -", so clamp first.
+	i = min(i, fen.size());
+
+	while (i < fen.size() && fen[i] != ' ')
+		++i;
+
+	const char* next = fen.data() + i;
+	const char* end = fen.data() + fen.size();
+
+	for (int field = 0; field < 2; ++field)
+	{
+		while (next != end && *next == ' ')
+			++next;
+
+		if (next == end)
+			break;
+
+		unsigned int value = 0u;
+		from_chars_result result = from_chars(next, end, value);
+
+		if (result.ec != errc() || (result.ptr != end && *result.ptr != ' ')
+			|| value > (field == 0 ? 255u : 65535u))
+		{
+			clear();
+			return false;
+		}
+
+		if (field == 0)
+			state_.halfmoveClock = static_cast<uint8_t>(value);
+		else
+			fullmoveNumber_ = static_cast<uint16_t>(value);
+
+		next = result.ptr;
+	}
+
+	state_.key = computeKey();
+	return true;
+}
+
+uint64_t Position::computeKey() const
+{
+	uint64_t key = 0u;
+
+	for (uint8_t sq = 0; sq < 64; ++sq)
+	{
+		if (board_[sq] != NO_PIECE)
+			key ^= zobrist.pieces[board_[sq]][sq];
+	}
+
+	key ^= zobrist.castling[state_.castling];
+
+	if (state_.epSquare != NO_SQUARE)
+		key ^= zobrist.enPassant[file_of(state_.epSquare)];
+	if (sideToMove_ == BLACK)
+		key ^= zobrist.side;
+
+	return key;
+}
+
+string Position::fen() const
+{
+	string str;
+
+	for (int rank = 7; rank >= 0; --rank)
+	{
+		int empty = 0;
+
+		for (int file = 0; file < 8; ++file)
+		{
+			uint8_t piece = board_[make_square(file, rank)];
+
+			if (piece == NO_PIECE)
+			{
+				++empty;
+				continue;
+			}
+
+			if (empty > 0)
+				str += static_cast<char>('0' + empty);
+
+			str += piece_chars[piece];
+			empty = 0;
+		}
+
+		if (empty > 0)
+			str += static_cast<char>('0' + empty);
+		if (rank > 0)
+			str += '/';
+	}
+
+	str += sideToMove_ == WHITE ? " w " : " b ";
+
+	if (state_.castling == 0u)
+		str += '-';
+	if (state_.castling & WHITE_OO)
+		str += 'K';
+	if (state_.castling & WHITE_OOO)
+		str += 'Q';
+	if (state_.castling & BLACK_OO)
+		str += 'k';
+	if (state_.castling & BLACK_OOO)
+		str += 'q';
+
+	if (state_.epSquare == NO_SQUARE)
+		str += " -";
+	else
+	{
+		str += ' ';
+		str += static_cast<char>('a' + file_of(state_.epSquare));
+		str += static_cast<char>('1' + rank_of(state_.epSquare));
+	}
+
+	str += ' ' + to_string(state_.halfmoveClock) + ' ' + to_string(fullmoveNumber_);
+	return str;
+}
+
+Bitboard Position::attackersTo(uint8_t sq, Bitboard occupied) const
+{
+	return (pawn_attacks[WHITE][sq] & pieces_[Piece::BLACK_PAWN])
+	     | (pawn_attacks[BLACK][sq] & pieces_[Piece::WHITE_PAWN])
+	     | (knight_attacks[sq] & piecesOfType(Piece::WHITE_KNIGHT))
+	     | (bishop_attacks(sq, occupied) & (piecesOfType(Piece::WHITE_BISHOP) | piecesOfType(Piece::WHITE_QUEEN)))
+	     | (rook_attacks(sq, occupied) & (piecesOfType(Piece::WHITE_ROOK) | piecesOfType(Piece::WHITE_QUEEN)))
+	     | (king_attacks[sq] & piecesOfType(Piece::WHITE_KING));
+}
+
+bool Position::isRepetition() const
+{
+	size_t end = min<size_t>(state_.halfmoveClock, history_.size());
+
+	for (size_t i = 4; i <= end; i += 2)
+	{
+		if (history_[history_.size() - i].key == state_.key)
+			return true;
+	}
+
+	return false;
+}
+
+bool Position::isAttacked(uint8_t sq, uint8_t by_color) const
+{
+	return (attackersTo(sq, occupied()) & colors_[by_color]) != 0;
+}
+
+Bitboard Position::checkers() const
+{
+	return attackersTo(kingSquare(sideToMove_), occupied()) & colors_[sideToMove_ ^ 1u];
+}
+
+void Position::makeMove(Move move)
+{
+	history_.push_back(state_);
+
+	uint8_t us = sideToMove_;
+	uint8_t from = move.from();
+	uint8_t to = move.to();
+	uint8_t flags = move.flags();
+	uint8_t piece = board_[from];
+	uint8_t captured = NO_PIECE;
+	uint64_t key = state_.key ^ zobrist.side ^ zobrist.pieces[piece][from] ^ zobrist.pieces[piece][to];
+
+	if (state_.epSquare != NO_SQUARE)
+		key ^= zobrist.enPassant[file_of(state_.epSquare)];
+
+	state_.epSquare = NO_SQUARE;
+	++state_.halfmoveClock;
+
+	if (flags == Move::EN_PASSANT)
+	{
+		uint8_t cap_sq = us == WHITE ? to - 8 : to + 8;
+		captured = board_[cap_sq];
+		key ^= zobrist.pieces[captured][cap_sq];
+		removePiece(cap_sq);
+	}
+	else if (move.isCapture())
+	{
+		captured = board_[to];
+		key ^= zobrist.pieces[captured][to];
+		removePiece(to);
+	}
+
+	movePiece(from, to);
+
+	if (piece_type(piece) == Piece::WHITE_PAWN)
+	{
+		state_.halfmoveClock = 0u;
+
+		if (flags == Move::DOUBLE_PUSH)
+		{
+			uint8_t ep = (from + to) / 2;
+
+			if (pawn_attacks[us][ep] & pieces_[make_piece(us ^ 1u, Piece::WHITE_PAWN)])
+			{
+				state_.epSquare = ep;
+				key ^= zobrist.enPassant[file_of(ep)];
+			}
+		}
+		else if (move.isPromotion())
+		{
+			uint8_t promoted = make_piece(us, move.promotionType());
+			key ^= zobrist.pieces[piece][to] ^ zobrist.pieces[promoted][to];
+			removePiece(to);
+			putPiece(promoted, to);
+		}
+	}
+	else if (flags == Move::KING_CASTLE)
+	{
+		uint8_t rook = board_[to + 1];
+		key ^= zobrist.pieces[rook][to + 1] ^ zobrist.pieces[rook][to - 1];
+		movePiece(to + 1, to - 1);
+	}
+	else if (flags == Move::QUEEN_CASTLE)
+	{
+		uint8_t rook = board_[to - 2];
+		key ^= zobrist.pieces[rook][to - 2] ^ zobrist.pieces[rook][to + 1];
+		movePiece(to - 2, to + 1);
+	}
+
+	if (captured != NO_PIECE)
+		state_.halfmoveClock = 0u;
+
+	key ^= zobrist.castling[state_.castling];
+	state_.castling &= castling_mask[from] & castling_mask[to];
+	key ^= zobrist.castling[state_.castling];
+
+	state_.captured = captured;
+	state_.key = key;
+
+	if (us == BLACK)
+		++fullmoveNumber_;
+
+	sideToMove_ = us ^ 1u;
+}
+
+void Position::unmakeMove(Move move)
+{
+	uint8_t us = sideToMove_ ^ 1u;
+	uint8_t from = move.from();
+	uint8_t to = move.to();
+	uint8_t flags = move.flags();
+
+	sideToMove_ = us;
+
+	if (us == BLACK)
+		--fullmoveNumber_;
+
+	if (move.isPromotion())
+	{
+		removePiece(to);
+		putPiece(make_piece(us, Piece::WHITE_PAWN), to);
+	}
+	else if (flags == Move::KING_CASTLE)
+		movePiece(to - 1, to + 1);
+	else if (flags == Move::QUEEN_CASTLE)
+		movePiece(to + 1, to - 2);
+
+	movePiece(to, from);
+
+	if (flags == Move::EN_PASSANT)
+		putPiece(state_.captured, us == WHITE ? to - 8 : to + 8);
+	else if (state_.captured != NO_PIECE)
+		putPiece(state_.captured, to);
+
+	state_ = history_.back();
+	history_.pop_back();
+}
+
+Move Position::parseMove(strref str) const
+{
+	MoveList list;
+	generate_legal_moves(*this, list);
+
+	for (Move move : list)
+	{
+		if (move.toString() == str)
+			return move;
+	}
+
+	return Move();
+}
+
+string Position::toString() const
+{
+	string str;
+
+	for (int rank = 7; rank >= 0; --rank)
+	{
+		str += static_cast<char>('1' + rank);
+		str += ' ';
+
+		for (int file = 0; file < 8; ++file)
+		{
+			uint8_t piece = board_[make_square(file, rank)];
+			str += piece == NO_PIECE ? '.' : piece_chars[piece];
+			str += ' ';
+		}
+
+		str += '\n';
+	}
+
+	str += "  a b c d e f g h\n";
+	return str;
+}
\ No newline at end of file
@@ -0,0 +1,370 @@
+// Chess
+// Search.cpp
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Source file for the Search class.
+
+#include "Search.h"
+
+// Ordering scores. Captures and promotions are searched first,
+// then the two killers of the ply, then quiet moves by history.
+const int HASH_MOVE_SCORE = 2000000;
+const int CAPTURE_SCORE   = 1000000;
+const int KILLER_SCORE_1  = 900000;
+const int KILLER_SCORE_2  = 800000;
+const int HISTORY_MAX     = 700000;
+
+// Mate scores are stored relative to the node rather than the root,
+// so that they stay correct when the position is reached at another ply.
+inline int score_to_tt(int score, int ply)
+{
+	if (score >= MATE_SCORE - MAX_PLY)
+		return score + ply;
+	if (score <= -MATE_SCORE + MAX_PLY)
+		return score - ply;
+
+	return score;
+}
+
+inline int score_from_tt(int score, int ply)
+{
+	if (score >= MATE_SCORE - MAX_PLY)
+		return score - ply;
+	if (score <= -MATE_SCORE + MAX_PLY)
+		return score + ply;
+
+	return score;
+}
+
+// Moves the highest scored remaining Move to index i.
+inline void pick_move(MoveList& list, array<int, 256>& scores, size_t i)
+{
+	size_t best = i;
+
+	for (size_t j = i + 1; j < list.size(); ++j)
+	{
+		if (scores[j] > scores[best])
+			best = j;
+	}
+
+	swap(list[i], list[best]);
+	swap(scores[i], scores[best]);
+}
+
+int Search::negamax(int depth, int alpha, int beta, int ply)
+{
+	if ((++nodes_ & 2047u) == 0u)
+		checkTime();
+
+	if (stopped_)
+		return 0;
+
+	if (ply > 0 && (pos_.halfmoveClock() >= 100 || pos_.isRepetition()))
+		return 0;
+
+	bool in_check = pos_.inCheck();
+
+	// Extend checks so that forcing lines are not cut off at the horizon.
+	if (in_check)
+		++depth;
+
+	if (depth <= 0)
+		return quiescence(alpha, beta, ply);
+
+	if (ply >= MAX_PLY - 1)
+		return evaluate(pos_);
+
+	TTData tte;
+	Move hash_move;
+
+	if (tt_.probe(pos_.key(), tte))
+	{
+		hash_move = tte.move;
+
+		// The root always searches, so that it has a move to return.
+		if (ply > 0 && tte.depth >= depth)
+		{
+			int tt_score = score_from_tt(tte.score, ply);
+
+			if (tte.bound == TranspositionTable::BOUND_EXACT
+				|| (tte.bound == TranspositionTable::BOUND_LOWER && tt_score >= beta)
+				|| (tte.bound == TranspositionTable::BOUND_UPPER && tt_score <= alpha))
+				return tt_score;
+		}
+	}
+
+	MoveList list;
+	generate_legal_moves(pos_, list);
+
+	if (list.empty())
+		return in_check ? -MATE_SCORE + ply : 0;
+
+	array<int, 256> scores;
+	scoreMoves(list, scores, ply == 0 ? bestMove_ : hash_move, ply);
+
+	int alpha_orig = alpha;
+	int best_score = -INFINITE_SCORE;
+	Move best_move;
+
+	for (size_t i = 0; i < list.size(); ++i)
+	{
+		pick_move(list, scores, i);
+		Move move = list[i];
+
+		pos_.makeMove(move);
+		int score = -negamax(depth - 1, -beta, -alpha, ply + 1);
+		pos_.unmakeMove(move);
+
+		if (stopped_)
+			return 0;
+
+		if (score > best_score)
+		{
+			best_score = score;
+			best_move = move;
+
+			if (ply == 0)
+				rootBest_ = move;
+
+			if (score > alpha)
+			{
+				alpha = score;
+
+				if (alpha >= beta)
+				{
+					if (!move.isCapture() && !move.isPromotion())
+						updateQuietStats(move, depth, ply);
+
+					break;
+				}
+			}
+		}
+	}
+
+	uint8_t bound = best_score >= beta ? TranspositionTable::BOUND_LOWER
+	              : best_score > alpha_orig ? TranspositionTable::BOUND_EXACT
+	              : TranspositionTable::BOUND_UPPER;
+
+	tt_.store(pos_.key(), best_move, score_to_tt(best_score, ply), depth, bound);
+	return best_score;
+}
+
+int Search::quiescence(int alpha, int beta, int ply)
+{
+	if ((++nodes_ & 2047u) == 0u)
+		checkTime();
+
+	if (stopped_)
+		return 0;
+
+	bool in_check = pos_.inCheck();
+	int best_score = -INFINITE_SCORE;
+
+	if (ply >= MAX_PLY - 1)
+		return evaluate(pos_);
+
+	// Unless in check, the side to move may decline every capture.
+	if (!in_check)
+	{
+		best_score = evaluate(pos_);
+
+		if (best_score >= beta)
+			return best_score;
+
+		alpha = max(alpha, best_score);
+	}
+
+	MoveList list;
+
+	if (in_check)
+		generate_legal_moves(pos_, list);
+	else
+		generate_legal_captures(pos_, list);
+
+	if (in_check && list.empty())
+		return -MATE_SCORE + ply;
+
+	array<int, 256> scores;
+	scoreMoves(list, scores, Move(), ply);
+
+	for (size_t i = 0; i < list.size(); ++i)
+	{
+		pick_move(list, scores, i);
+		Move move = list[i];
+
+		pos_.makeMove(move);
+		int score = -quiescence(-beta, -alpha, ply + 1);
+		pos_.unmakeMove(move);
+
+		if (stopped_)
+			return 0;
+
+		if (score > best_score)
+		{
+			best_score = score;
+
+			if (score > alpha)
+			{
+				alpha = score;
+
+				if (alpha >= beta)
+					break;
+			}
+		}
+	}
+
+	return best_score;
+}
+
+void Search::scoreMoves(const MoveList& list, array<int, 256>& scores, Move hash_move, int ply) const
+{
+	uint8_t us = pos_.sideToMove();
+
+	for (size_t i = 0; i < list.size(); ++i)
+	{
+		Move move = list[i];
+
+		if (move == hash_move)
+			scores[i] = HASH_MOVE_SCORE;
+		else if (move.isCapture() || move.isPromotion())
+		{
+			// Most valuable victim, least valuable attacker.
+			uint8_t victim = move.flags() == Move::EN_PASSANT ? Piece::WHITE_PAWN : piece_type(pos_.pieceOn(move.to()));
+			uint8_t attacker = piece_type(pos_.pieceOn(move.from()));
+
+			scores[i] = CAPTURE_SCORE - piece_values[attacker] / 100;
+
+			if (move.isCapture())
+				scores[i] += piece_values[victim] * 10;
+			if (move.isPromotion())
+				scores[i] += piece_values[move.promotionType()];
+		}
+		else if (move == killers_[ply][0])
+			scores[i] = KILLER_SCORE_1;
+		else if (move == killers_[ply][1])
+			scores[i] = KILLER_SCORE_2;
+		else
+			scores[i] = history_[us][move.from()][move.to()];
+	}
+}
+
+void Search::updateQuietStats(Move move, int depth, int ply)
+{
+	if (killers_[ply][0] != move)
+	{
+		killers_[ply][1] = killers_[ply][0];
+		killers_[ply][0] = move;
+	}
+
+	int& h = history_[pos_.sideToMove()][move.from()][move.to()];
+	h += depth * depth;
+
+	// Keep history below the killer scores by halving the whole table.
+	if (h >= HISTORY_MAX)
+	{
+		for (auto& from : history_[pos_.sideToMove()])
+		{
+			for (int& value : from)
+				value /= 2;
+		}
+	}
+}
+
+void Search::checkTime()
+{
+	if (stop_ != nullptr && stop_->load(memory_order_relaxed))
+		stopped_ = true;
+	else if (depthReached_ > 0u && clock_.getElapsedTime() >= budget_)
+		stopped_ = true;
+}
+
+Search::Search(TranspositionTable& tt, const atomic<bool>* stop, uint32_t id)
+	: tt_(tt), stop_(stop), id_(id), nodes_(0u), stopped_(false), bestScore_(0), depthReached_(0u)
+{
+	for (auto& k : killers_)
+		k.fill(Move());
+
+	for (auto& color : history_)
+	{
+		for (auto& from : color)
+			from.fill(0);
+	}
+}
+
+Move Search::think(const Position& pos, Time budget, uint32_t max_depth)
+{
+	pos_ = pos;
+	budget_ = budget;
+	nodes_ = 0u;
+	stopped_ = false;
+	rootBest_ = Move();
+	bestMove_ = Move();
+	bestScore_ = 0;
+	depthReached_ = 0u;
+	clock_.restart();
+
+	for (auto& k : killers_)
+		k.fill(Move());
+
+	// Keep some of the history from the previous search, but let it fade.
+	for (auto& color : history_)
+	{
+		for (auto& from : color)
+		{
+			for (int& value : from)
+				value /= 8;
+		}
+	}
+
+	MoveList root;
+	generate_legal_moves(pos_, root);
+
+	if (root.empty())
+		return Move();
+
+	bestMove_ = root[0];
+
+	if (root.size() == 1u)
+		return bestMove_;
+
+	max_depth = clamp<uint32_t>(max_depth, 1u, MAX_PLY - 1);
+
+	for (uint32_t depth = 1u + (id_ & 1u); depth <= max_depth; ++depth)
+	{
+		int score = negamax(static_cast<int>(depth), -INFINITE_SCORE, INFINITE_SCORE, 0);
+
+		// A depth that ran out of time is thrown away.
+		if (stopped_)
+			break;
+
+		bestMove_ = rootBest_;
+		bestScore_ = score;
+		depthReached_ = depth;
+
+		if (abs(score) >= MATE_SCORE - MAX_PLY)
+			break;
+
+		// The next depth usually takes several times longer than this one,
+		// so do not start it if it has no chance of finishing.
+		if (clock_.getElapsedTime() * 2.f >= budget_)
+			break;
+	}
+
+	return bestMove_;
+}
+
+uint64_t Search::nodes() const
+{
+	return nodes_;
+}
+
+int Search::score() const
+{
+	return bestScore_;
+}
+
+uint32_t Search::depth() const
+{
+	return depthReached_;
+}
\ No newline at end of file
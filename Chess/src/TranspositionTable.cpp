@@ -0,0 +1,172 @@
+// Chess
+// TranspositionTable.cpp
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Source file for the TranspositionTable class.
+
+#include "TranspositionTable.h"
+
+// Layout of an entry's data word:
+//  - bits 0-15:  best move
+//  - bits 16-31: score
+//  - bits 32-39: depth
+//  - bits 40-41: bound
+//  - bits 42-47: generation
+inline uint64_t pack(Move move, int score, int depth, uint8_t bound, uint8_t generation)
+{
+	return static_cast<uint64_t>(move.raw())
+	     | (static_cast<uint64_t>(static_cast<uint16_t>(score)) << 16)
+	     | (static_cast<uint64_t>(clamp(depth, 0, 255)) << 32)
+	     | (static_cast<uint64_t>(bound & 3u) << 40)
+	     | (static_cast<uint64_t>(generation & 63u) << 42);
+}
+
+inline uint16_t move_of(uint64_t data)
+{
+	return static_cast<uint16_t>(data);
+}
+
+inline int depth_of(uint64_t data)
+{
+	return static_cast<int>((data >> 32) & 0xFFu);
+}
+
+inline uint8_t bound_of(uint64_t data)
+{
+	return static_cast<uint8_t>((data >> 40) & 3u);
+}
+
+inline uint8_t generation_of(uint64_t data)
+{
+	return static_cast<uint8_t>((data >> 42) & 63u);
+}
+
+TranspositionTable::TranspositionTable(size_t size_mb)
+	: mask_(0u), generation_(0u)
+{
+	resize(size_mb);
+}
+
+void TranspositionTable::resize(size_t size_mb)
+{
+	size_t count = max<size_t>(size_mb * 1024u * 1024u / sizeof(Bucket), 1u);
+
+	// Round down to a power of two so a bucket is found with a mask.
+	count = bit_floor(count);
+
+	buckets_ = vector<Bucket>(count);
+	mask_ = count - 1u;
+	clear();
+}
+
+void TranspositionTable::clear()
+{
+	for (Bucket& bucket : buckets_)
+	{
+		for (Entry& e : bucket.entries)
+		{
+			e.check.store(0u, memory_order_relaxed);
+			e.data.store(0u, memory_order_relaxed);
+		}
+	}
+
+	generation_ = 0u;
+}
+
+void TranspositionTable::newSearch()
+{
+	generation_ = (generation_ + 1u) & 63u;
+}
+
+bool TranspositionTable::probe(uint64_t key, TTData& data) const
+{
+	const Bucket& bucket = buckets_[key & mask_];
+
+	for (const Entry& e : bucket.entries)
+	{
+		uint64_t d = e.data.load(memory_order_relaxed);
+
+		if ((e.check.load(memory_order_relaxed) ^ d) == key && bound_of(d) != BOUND_NONE)
+		{
+			data.move = Move(move_of(d));
+			data.score = static_cast<int16_t>(static_cast<uint16_t>(d >> 16));
+			data.depth = static_cast<uint8_t>(depth_of(d));
+			data.bound = bound_of(d);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void TranspositionTable::store(uint64_t key, Move move, int score, int depth, uint8_t bound)
+{
+	Bucket& bucket = buckets_[key & mask_];
+	Entry* replace = &bucket.entries[0];
+	int worst = INT32_MAX;
+
+	for (Entry& e : bucket.entries)
+	{
+		uint64_t d = e.data.load(memory_order_relaxed);
+
+		if ((e.check.load(memory_order_relaxed) ^ d) == key)
+		{
+			// Keep a deeper result for the same position from this search,
+			// unless the new one is exact.
+			if (bound != BOUND_EXACT && generation_of(d) == generation_ && depth + 2 < depth_of(d))
+				return;
+
+			if (move.isNull())
+				move = Move(move_of(d));
+
+			replace = &e;
+			break;
+		}
+
+		if (bound_of(d) == BOUND_NONE)
+		{
+			replace = &e;
+			break;
+		}
+
+		// Otherwise replace the shallowest entry, counting every
+		// search since it was stored as 8 plies of lost depth.
+		int age = (generation_ - generation_of(d)) & 63;
+		int value = depth_of(d) - 8 * age;
+
+		if (value < worst)
+		{
+			worst = value;
+			replace = &e;
+		}
+	}
+
+	uint64_t d = pack(move, score, depth, bound, generation_);
+	replace->check.store(key ^ d, memory_order_relaxed);
+	replace->data.store(d, memory_order_relaxed);
+}
+
+size_t TranspositionTable::size() const
+{
+	return buckets_.size() * sizeof(Bucket);
+}
+
+int TranspositionTable::hashfull() const
+{
+	size_t sample = min<size_t>(buckets_.size(), 250u);
+	int used = 0;
+
+	for (size_t i = 0; i < sample; ++i)
+	{
+		for (const Entry& e : buckets_[i].entries)
+		{
+			uint64_t d = e.data.load(memory_order_relaxed);
+
+			if (bound_of(d) != BOUND_NONE && generation_of(d) == generation_)
+				++used;
+		}
+	}
+
+	return static_cast<int>(used * 1000 / (sample * 4));
+}
\ No newline at end of file
@@ -2,34 +2,59 @@
 // main.cpp
 // Justyn Durnford
 // Created on 2021-05-16
-// Last modified on 2021-05-20
+// Last modified on 2026-10-17
 // Main source file
 
 #include "Game.h"
 
-template <typename T, std::size_t X, std::size_t Y>
-void print(const Matrix<T, X, Y>& M)
+// Piece textures in the order of the Piece ids, followed by the board.
+array<Texture, 13> textures;
+array<Piece, 6> white_pieces;
+array<Piece, 6> black_pieces;
+
+const array<string, 6> piece_names = { "pawn", "rook", "knight", "bishop", "queen", "king" };
+
+// Loads every texture from the textures folder and builds the pieces on them.
+// Returns false if any file cannot be loaded.
+bool load_textures()
 {
-	for (std::size_t r(0u); r < Y; ++r)
+	for (uint8_t i = 0; i < 12; ++i)
 	{
-		cout << "{ ";
-		for (std::size_t c(0u); c < X - 1; ++c)
-			cout << M(c, r) << ", ";
-		cout << M(X - 1, r) << " }" << endl;
+		string name = (i < 6 ? "w_" : "b_") + piece_names[i % 6];
+		string filename = "textures/" + name + ".png";
+
+		if (!textures[i].loadFromFile(filename))
+		{
+			cout << "ERROR: Could not open file " << filename << endl;
+			return false;
+		}
+
+		textures[i].setSmooth(true);
+
+		if (i < 6)
+			white_pieces[i] = Piece(i, name, &textures[i]);
+		else
+			black_pieces[i - 6] = Piece(i, name, &textures[i]);
 	}
+
+	if (!textures[12].loadFromFile("textures/board.png"))
+	{
+		cout << "ERROR: Could not open file textures/board.png" << endl;
+		return false;
+	}
+
+	return true;
 }
 
 int main()
 {
-	Matrix<int, 3, 3> A
-	{
-		{ -2, -1, 2 },
-		{ 2, 1, 4 },
-		{ -3, 3, -1 }
-	};
+	init_bitboards();
+
+	if (!load_textures())
+		return -1;
 
-	print(A);
-	cout << determinant(A) << endl;
+	Game game(window_width, window_height);
+	game.run();
 
 	return 0;
 }
\ No newline at end of file
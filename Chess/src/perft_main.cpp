@@ -0,0 +1,235 @@
+// Chess
+// perft_main.cpp
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-17
+// Main file of the headless Perft target.
+//
+// Usage: Perft [options]
+//   --fen <FEN>        Position to count from (default: the start position)
+//   --depth <n>        Depth to count to (default: 5)
+//   --divide           Print the node count below every root move
+//   --threads <n>      Threads for the root split (default: all cores)
+//   --suite [file]     Check the built-in suite, or an EPD perft suite file
+//                      with lines of the form "<FEN> ;D1 20 ;D2 400 ..."
+//   --max-depth <n>    Skip suite entries deeper than n
+//
+// Exits with 1 if any suite entry does not match its expected count.
+
+#include "Perft.h"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+struct SuiteEntry
+{
+	string fen;
+	vector<uint64_t> counts; // counts[d - 1] is the node count at depth d
+};
+
+// The standard positions from the Chess Programming Wiki,
+// followed by Martin Sedlak's collection of special cases.
+const vector<SuiteEntry> builtin_suite =
+{
+	{ "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", { 20, 400, 8902, 197281, 4865609, 119060324 } },
+	{ "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", { 48, 2039, 97862, 4085603, 193690690 } },
+	{ "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1", { 14, 191, 2812, 43238, 674624, 11030083 } },
+	{ "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1", { 6, 264, 9467, 422333, 15833292 } },
+	{ "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8", { 44, 1486, 62379, 2103487, 89941194 } },
+	{ "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10", { 46, 2079, 89890, 3894594, 164075551 } },
+	{ "8/8/1k6/2b5/2pP4/8/5K2/8 b - d3 0 1", { 0, 0, 0, 0, 0, 1440467 } },
+	{ "8/5bk1/8/2Pp4/8/1K6/8/8 w - d6 0 1", { 0, 0, 0, 0, 0, 824064 } },
+	{ "8/8/4k3/8/2p5/8/B2P2K1/8 w - - 0 1", { 0, 0, 0, 0, 0, 1015133 } },
+	{ "r3k2r/1b4bq/8/8/8/8/7B/R3K2R w KQkq - 0 1", { 0, 0, 0, 1274206 } },
+	{ "r3k2r/8/3Q4/8/8/5q2/8/R3K2R b KQkq - 0 1", { 0, 0, 0, 1720476 } },
+	{ "2K2r2/4P3/8/8/8/8/8/3k4 w - - 0 1", { 0, 0, 0, 0, 0, 3821001 } },
+	{ "8/8/1P2K3/8/2n5/1q6/8/5k2 b - - 0 1", { 0, 0, 0, 0, 1004658 } },
+	{ "4k3/1P6/8/8/8/8/K7/8 w - - 0 1", { 0, 0, 0, 0, 0, 217342 } },
+	{ "8/P1k5/K7/8/8/8/8/8 w - - 0 1", { 0, 0, 0, 0, 0, 92683 } },
+	{ "K1k5/8/P7/8/8/8/8/8 w - - 0 1", { 0, 0, 0, 0, 0, 2217 } },
+	{ "8/k1P5/8/1K6/8/8/8/8 w - - 0 1", { 0, 0, 0, 0, 0, 0, 567584 } },
+	{ "8/8/2k5/5q2/5n2/8/5K2/8 b - - 0 1", { 0, 0, 0, 23527 } },
+	// Truncated FENs, as found in EPD files, with the trailing fields left out.
+	{ "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -", { 20, 400, 8902 } },
+	{ "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w -", { 14, 191, 2812 } },
+	{ "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w", { 14, 191, 2812 } }
+};
+
+// Reads a suite in the EPD layout used by the common perftsuite.epd files.
+// A count of 0 means the depth is not checked.
+vector<SuiteEntry> load_suite(strref filename)
+{
+	vector<SuiteEntry> suite;
+	ifstream file(filename);
+	string line;
+
+	while (getline(file, line))
+	{
+		stringstream ss(line);
+		string field;
+
+		if (!getline(ss, field, ';') || field.find('/') == string::npos)
+			continue;
+
+		SuiteEntry entry;
+		entry.fen = field.substr(0, field.find_last_not_of(' ') + 1);
+
+		while (getline(ss, field, ';'))
+		{
+			stringstream fs(field);
+			string tag;
+			uint64_t count;
+
+			if (fs >> tag >> count && tag.size() > 1 && tag[0] == 'D')
+			{
+				size_t depth = stoul(tag.substr(1));
+
+				if (depth > 0)
+				{
+					entry.counts.resize(max(entry.counts.size(), depth), 0);
+					entry.counts[depth - 1] = count;
+				}
+			}
+		}
+
+		suite.push_back(entry);
+	}
+
+	return suite;
+}
+
+// Runs every entry of the suite up to max_depth.
+// Returns the number of mismatches.
+int run_suite(const vector<SuiteEntry>& suite, uint32_t max_depth, uint32_t thread_count)
+{
+	int failures = 0;
+	uint64_t total_nodes = 0;
+	Clock clock;
+
+	for (const SuiteEntry& entry : suite)
+	{
+		Position pos;
+
+		if (!pos.setFEN(entry.fen))
+		{
+			cout << "ERROR: Could not parse FEN " << entry.fen << endl;
+			++failures;
+			continue;
+		}
+
+		for (uint32_t depth = 1; depth <= entry.counts.size() && depth <= max_depth; ++depth)
+		{
+			uint64_t expected = entry.counts[depth - 1];
+
+			if (expected == 0)
+				continue;
+
+			uint64_t nodes = perft_parallel(pos, depth, thread_count);
+			total_nodes += nodes;
+
+			if (nodes != expected)
+			{
+				cout << "FAIL " << entry.fen << " depth " << depth
+				     << ": " << nodes << " (expected " << expected << ')' << endl;
+				++failures;
+			}
+		}
+	}
+
+	float s = clock.getElapsedTime().asSeconds();
+
+	cout << suite.size() << " positions, " << failures << " failures, "
+	     << total_nodes << " nodes in " << s << " s ("
+	     << static_cast<uint64_t>(total_nodes / max(s, 0.001f)) << " nps)" << endl;
+
+	return failures;
+}
+
+int main(int argc, char* argv[])
+{
+	string fen = start_fen;
+	uint32_t depth = 5;
+	uint32_t max_depth = 64;
+	uint32_t thread_count = max(thread::hardware_concurrency(), 1u);
+	bool divide = false;
+	bool suite = false;
+	string suite_file;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		string arg = argv[i];
+
+		if (arg == "--fen" && i + 1 < argc)
+			fen = argv[++i];
+		else if (arg == "--depth" && i + 1 < argc)
+			depth = static_cast<uint32_t>(stoul(argv[++i]));
+		else if (arg == "--max-depth" && i + 1 < argc)
+			max_depth = static_cast<uint32_t>(stoul(argv[++i]));
+		else if (arg == "--threads" && i + 1 < argc)
+			thread_count = max(static_cast<uint32_t>(stoul(argv[++i])), 1u);
+		else if (arg == "--divide")
+			divide = true;
+		else if (arg == "--suite")
+		{
+			suite = true;
+
+			if (i + 1 < argc && argv[i + 1][0] != '-')
+				suite_file = argv[++i];
+		}
+		else
+		{
+			cout << "ERROR: Unknown argument " << arg << endl;
+			return -1;
+		}
+	}
+
+	init_bitboards();
+
+	if (suite)
+	{
+		vector<SuiteEntry> entries = suite_file.empty() ? builtin_suite : load_suite(suite_file);
+
+		if (entries.empty())
+		{
+			cout << "ERROR: Could not read suite " << suite_file << endl;
+			return -1;
+		}
+
+		return run_suite(entries, max_depth, thread_count) == 0 ? 0 : 1;
+	}
+
+	Position pos;
+
+	if (!pos.setFEN(fen))
+	{
+		cout << "ERROR: Could not parse FEN " << fen << endl;
+		return -1;
+	}
+
+	Clock clock;
+	uint64_t nodes = 0;
+
+	if (divide)
+	{
+		for (const PerftEntry& entry : perft_divide(pos, depth, thread_count))
+		{
+			cout << entry.move.toString() << ": " << entry.nodes << endl;
+			nodes += entry.nodes;
+		}
+
+		cout << endl;
+	}
+	else
+		nodes = perft_parallel(pos, depth, thread_count);
+
+	float s = clock.getElapsedTime().asSeconds();
+
+	cout << "Nodes: " << nodes << endl;
+	cout << "Time: " << fixed << setprecision(3) << s << " s" << endl;
+	cout << "NPS: " << static_cast<uint64_t>(nodes / max(s, 0.001f)) << endl;
+	cout << "Threads: " << thread_count << endl;
+
+	return 0;
+}
\ No newline at end of file
@@ -2,7 +2,7 @@
 // 
 // This is an added file for this modified version of SFML 2.5.1
 // Modified by Justyn Durnford
-// Last modified on 2021-05-20
+// Last modified on 2026-10-17
 // 
 // SFML - Simple and Fast Multimedia Library
 // Copyright (X) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
@@ -30,6 +30,8 @@
 #define SFML_MATRIX_HPP
 
 #include <SFML/System/Arithmetic.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <SFML/System/Vector3.hpp>
 
 #include <algorithm>
 #include <array>
@@ -37,9 +39,52 @@
 #include <cstddef>
 #include <initializer_list>
 #include <stdexcept>
+#include <utility>
+#include <type_traits>
+
+#if defined(__AVX__)
+	#define SFML_MATRIX_AVX
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define SFML_MATRIX_SSE2
+#endif
+
+#if defined(SFML_MATRIX_AVX)
+	#include <immintrin.h>
+#elif defined(SFML_MATRIX_SSE2)
+	#include <emmintrin.h>
+#endif
 
 namespace sf
 {
+	// Anything with a size known at compile time whose elements are read
+	// with (x, y): a Matrix, or the lazy result of an element-wise operator.
+	template <typename E>
+	concept matrix_expression = requires
+	{
+		requires std::remove_cvref_t<E>::is_matrix_expression;
+	};
+
+	template <arithmetic T, std::size_t X, std::size_t Y> class Matrix;
+
+	namespace priv
+	{
+		//
+		template <typename E> struct is_matrix : std::false_type {};
+
+		//
+		template <arithmetic T, std::size_t X, std::size_t Y>
+		struct is_matrix<::sf::Matrix<T, X, Y>> : std::true_type {};
+
+		// True if A and B have the same size and element type.
+		template <typename A, typename B>
+		concept same_shape = matrix_expression<A> && matrix_expression<B>
+			&& std::remove_cvref_t<A>::col_count == std::remove_cvref_t<B>::col_count
+			&& std::remove_cvref_t<A>::row_count == std::remove_cvref_t<B>::row_count
+			&& std::same_as<typename std::remove_cvref_t<A>::value_type, typename std::remove_cvref_t<B>::value_type>;
+	}
+
 	template <arithmetic T, std::size_t X, std::size_t Y> class Matrix
 	{
 		// Private member variable
@@ -48,21 +93,21 @@ namespace sf
 		// Private member functions
 
 		//
-		inline void checkRow(std::size_t r) const
+		constexpr void checkRow(std::size_t r) const
 		{
 			if (r >= Y)
 				throw std::out_of_range("Invalid row index");
 		}
 
 		//
-		inline void checkCol(std::size_t c) const
+		constexpr void checkCol(std::size_t c) const
 		{
 			if (c >= X)
 				throw std::out_of_range("Invalid column index");
 		}
 
-		// 
-		void checkBounds(std::size_t x, std::size_t y) const
+		//
+		constexpr void checkBounds(std::size_t x, std::size_t y) const
 		{
 			checkRow(y);
 			checkCol(x);
@@ -75,11 +120,16 @@ namespace sf
 		using reference = T&;
 		using const_reference = const T&;
 
-		// 
+		static constexpr bool is_matrix_expression = true;
+		static constexpr std::size_t col_count = X;
+		static constexpr std::size_t row_count = Y;
+
+		//
 		Matrix() = default;
 
-		// 
-		Matrix(const T& value)
+		//
+		constexpr Matrix(const T& value)
+			: data_{}
 		{
 			for (std::size_t r(0u); r < Y; ++r)
 			{
@@ -88,8 +138,9 @@ namespace sf
 			}
 		}
 
-		// 
-		Matrix(std::initializer_list<std::initializer_list<T>> list)
+		//
+		constexpr Matrix(std::initializer_list<std::initializer_list<T>> list)
+			: data_{}
 		{
 			std::size_t r(0u);
 
@@ -100,25 +151,40 @@ namespace sf
 			}
 		}
 
-		// 
+		//
 		template <arithmetic U>
-		explicit Matrix(const Matrix<U, X, Y>& other)
+		constexpr explicit Matrix(const Matrix<U, X, Y>& other)
+			: data_{}
 		{
 			for (std::size_t r(0u); r < Y; ++r)
 			{
 				for (std::size_t c(0u); c < X; ++c)
-					data_[r][c] = static_cast<T>(other.data_[r][c]);
+					data_[r][c] = static_cast<T>(other(c, r));
 			}
 		}
 
-		// 
-		Matrix(const Matrix& other) = default;
+		// Evaluates an expression such as A + B * s - C in a single loop,
+		// writing each element once.
+		template <matrix_expression E>
+			requires (!priv::is_matrix<std::remove_cvref_t<E>>::value && priv::same_shape<E, Matrix>)
+		constexpr Matrix(const E& expression)
+			: data_{}
+		{
+			for (std::size_t r(0u); r < Y; ++r)
+			{
+				for (std::size_t c(0u); c < X; ++c)
+					data_[r][c] = expression(c, r);
+			}
+		}
 
-		// 
-		Matrix(Matrix&& other) = default;
+		//
+		constexpr Matrix(const Matrix& other) = default;
+
+		//
+		constexpr Matrix(Matrix&& other) = default;
 
-		// 
-		Matrix& operator = (std::initializer_list<std::initializer_list<T>> list)
+		//
+		constexpr Matrix& operator = (std::initializer_list<std::initializer_list<T>> list)
 		{
 			std::size_t r(0u);
 
@@ -131,39 +197,77 @@ namespace sf
 			return *this;
 		}
 
-		// 
-		Matrix& operator = (const Matrix& other) = default;
+		//
+		constexpr Matrix& operator = (const Matrix& other) = default;
+
+		//
+		constexpr Matrix& operator = (Matrix && other) = default;
 
-		// 
-		Matrix& operator = (Matrix && other) = default;
+		// Evaluates the expression in a single loop. Element-wise expressions
+		// only read the element being written, so they may contain this Matrix.
+		template <matrix_expression E>
+			requires (!priv::is_matrix<std::remove_cvref_t<E>>::value && priv::same_shape<E, Matrix>)
+		constexpr Matrix& operator = (const E& expression)
+		{
+			for (std::size_t r(0u); r < Y; ++r)
+			{
+				for (std::size_t c(0u); c < X; ++c)
+					data_[r][c] = expression(c, r);
+			}
 
-		// 
-		~Matrix() = default;
+			return *this;
+		}
 
-		// 
-		std::size_t rowCount() const
+		//
+		constexpr ~Matrix() = default;
+
+		// Returns the square Matrix with ones on the diagonal and zeros elsewhere.
+		static constexpr Matrix identity() requires (X == Y)
+		{
+			Matrix M(static_cast<T>(0));
+
+			for (std::size_t i(0u); i < X; ++i)
+				M.data_[i][i] = static_cast<T>(1);
+
+			return M;
+		}
+
+		//
+		constexpr std::size_t rowCount() const
 		{
 			return Y;
 		}
 
-		// 
-		std::size_t colCount() const
+		//
+		constexpr std::size_t colCount() const
 		{
 			return X;
 		}
 
+		// Returns a pointer to the elements, stored row after row.
+		constexpr T* data()
+		{
+			return data_[0].data();
+		}
+
+		// Returns a pointer to the elements, stored row after row.
+		constexpr const T* data() const
+		{
+			return data_[0].data();
+		}
+
 		//
-		std::array<T, X> getRow(std::size_t y) const
+		constexpr std::array<T, X> getRow(std::size_t y) const
 		{
 			checkRow(y);
 			return data_[y];
 		}
 
 		//
-		std::array<T, Y> getCol(std::size_t x) const
+		constexpr std::array<T, Y> getCol(std::size_t x) const
 		{
-			checkRow(x);
-			std::array<T, Y> arr;
+			checkCol(x);
+			std::array<T, Y> arr{};
 
 			for (std::size_t r = 0; r < Y; ++r)
 				arr[r] = data_[r][x];
@@ -171,68 +275,70 @@ namespace sf
 			return arr;
 		}
 
-		// 
-		T& at(std::size_t x, std::size_t y)
+		//
+		constexpr T& at(std::size_t x, std::size_t y)
 		{
 			checkBounds(x, y);
 			return data_[y][x];
 		}
 
-		// 
-		const T& at(std::size_t x, std::size_t y) const
+		//
+		constexpr const T& at(std::size_t x, std::size_t y) const
 		{
 			checkBounds(x, y);
 			return data_[y][x];
 		}
 
-		// 
-		void set(std::size_t x, std::size_t y, const T& value)
+		//
+		constexpr void set(std::size_t x, std::size_t y, const T& value)
 		{
 			checkBounds(x, y);
 			data_[y][x] = value;
 		}
 
-		// 
-		T& operator () (std::size_t x, std::size_t y)
+		//
+		constexpr T& operator () (std::size_t x, std::size_t y)
 		{
 			return data_[y][x];
 		}
 
-		// 
-		const T& operator () (std::size_t x, std::size_t y) const
+		//
+		constexpr const T& operator () (std::size_t x, std::size_t y) const
 		{
 			return data_[y][x];
 		}
 
-		// 
-		template <arithmetic U> 
-		Matrix& operator += (const Matrix<U, X, Y>& other)
+		// other may be a Matrix of another element type, or an expression.
+		template <matrix_expression E>
+			requires (std::remove_cvref_t<E>::col_count == X && std::remove_cvref_t<E>::row_count == Y)
+		constexpr Matrix& operator += (const E& other)
 		{
 			for (std::size_t r(0u); r < Y; ++r)
 			{
 				for (std::size_t c(0u); c < X; ++c)
-					data_[r][c] += static_cast<T>(other.data_[r][c]);
+					data_[r][c] += static_cast<T>(other(c, r));
 			}
 
 			return *this;
 		}
 
-		// 
-		template <arithmetic U>
-		Matrix& operator -= (const Matrix<U, X, Y>& other)
+		// other may be a Matrix of another element type, or an expression.
+		template <matrix_expression E>
+			requires (std::remove_cvref_t<E>::col_count == X && std::remove_cvref_t<E>::row_count == Y)
+		constexpr Matrix& operator -= (const E& other)
 		{
 			for (std::size_t r(0u); r < Y; ++r)
 			{
 				for (std::size_t c(0u); c < X; ++c)
-					data_[r][c] -= static_cast<T>(other.data_[r][c]);
+					data_[r][c] -= static_cast<T>(other(c, r));
 			}
 
 			return *this;
 		}
 
-		// 
-		template <arithmetic U> 
-		Matrix& operator *= (U scalar)
+		//
+		template <arithmetic U>
+		constexpr Matrix& operator *= (U scalar)
 		{
 			for (std::size_t r(0u); r < Y; ++r)
 			{
@@ -243,9 +349,16 @@ namespace sf
 			return *this;
 		}
 
-		// 
-		template <arithmetic U> 
-		Matrix& operator /= (U scalar)
+		// Multiplies this Matrix by other, on the right.
+		constexpr Matrix& operator *= (const Matrix<T, X, X>& other)
+		{
+			*this = *this * other;
+			return *this;
+		}
+
+		//
+		template <arithmetic U>
+		constexpr Matrix& operator /= (U scalar)
 		{
 			for (std::size_t r(0u); r < Y; ++r)
 			{
@@ -257,81 +370,691 @@ namespace sf
 		}
 	};
 
-	template <arithmetic T> 
-	inline T determinant(const Matrix<T, 2, 2>& M)
+	// Returns the Matrix with the rows and columns of M swapped.
+	template <arithmetic T, std::size_t X, std::size_t Y>
+	constexpr Matrix<T, Y, X> transpose(const Matrix<T, X, Y>& M)
 	{
-		return (M(0, 0) * M(1, 1)) - (M(0, 1) * M(1, 0));
+		Matrix<T, Y, X> R(static_cast<T>(0));
+
+		for (std::size_t r(0u); r < Y; ++r)
+		{
+			for (std::size_t c(0u); c < X; ++c)
+				R(r, c) = M(c, r);
+		}
+
+		return R;
 	}
-	
-	template <arithmetic T>
-	T determinant(const Matrix<T, 3, 3>& M)
+
+	namespace priv
 	{
-		Matrix<T, 2, 2> A
+		// Products of square float and double matrices of size 2, 3 and 4
+		// stored row after row. C must not overlap A or B.
+		// Each row of C is built as a sum of the rows of B, scaled by the
+		// elements of the same row of A, so that whole rows are computed at once.
+
+		#if defined(SFML_MATRIX_SSE2)
+
+		inline void multiply_2x2(const float* A, const float* B, float* C)
 		{
-			{ M(1, 1), M(2, 1) },
-			{ M(1, 2), M(2, 2) }
+			__m128 a = _mm_loadu_ps(A);
+			__m128 b = _mm_loadu_ps(B);
+
+			// (a00 a00 a10 a10) * (b00 b01 b00 b01) + (a01 a01 a11 a11) * (b10 b11 b10 b11)
+			__m128 a_0 = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 0, 0));
+			__m128 a_1 = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 1, 1));
+			__m128 b_0 = _mm_movelh_ps(b, b);
+			__m128 b_1 = _mm_movehl_ps(b, b);
+
+			_mm_storeu_ps(C, _mm_add_ps(_mm_mul_ps(a_0, b_0), _mm_mul_ps(a_1, b_1)));
+		}
+
+		// Loads three floats into the low lanes without reading past them.
+		inline __m128 load_3(const float* p)
+		{
+			__m128 xy = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(p));
+			return _mm_movelh_ps(xy, _mm_load_ss(p + 2));
+		}
+
+		// Stores the three low lanes without writing past them.
+		inline void store_3(float* p, __m128 v)
+		{
+			_mm_storel_pi(reinterpret_cast<__m64*>(p), v);
+			_mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+		}
+
+		inline void multiply_3x3(const float* A, const float* B, float* C)
+		{
+			__m128 b_0 = load_3(B);
+			__m128 b_1 = load_3(B + 3);
+			__m128 b_2 = load_3(B + 6);
+
+			for (std::size_t r(0u); r < 3u; ++r)
+			{
+				const float* a = A + r * 3u;
+				__m128 c = _mm_mul_ps(_mm_set1_ps(a[0]), b_0);
+				c = _mm_add_ps(c, _mm_mul_ps(_mm_set1_ps(a[1]), b_1));
+				c = _mm_add_ps(c, _mm_mul_ps(_mm_set1_ps(a[2]), b_2));
+				store_3(C + r * 3u, c);
+			}
+		}
+
+		inline void multiply_4x4(const float* A, const float* B, float* C)
+		{
+			__m128 b_0 = _mm_loadu_ps(B);
+			__m128 b_1 = _mm_loadu_ps(B + 4);
+			__m128 b_2 = _mm_loadu_ps(B + 8);
+			__m128 b_3 = _mm_loadu_ps(B + 12);
+
+			for (std::size_t r(0u); r < 4u; ++r)
+			{
+				const float* a = A + r * 4u;
+				__m128 c = _mm_mul_ps(_mm_set1_ps(a[0]), b_0);
+				c = _mm_add_ps(c, _mm_mul_ps(_mm_set1_ps(a[1]), b_1));
+				c = _mm_add_ps(c, _mm_mul_ps(_mm_set1_ps(a[2]), b_2));
+				c = _mm_add_ps(c, _mm_mul_ps(_mm_set1_ps(a[3]), b_3));
+				_mm_storeu_ps(C + r * 4u, c);
+			}
+		}
+
+		inline void multiply_2x2(const double* A, const double* B, double* C)
+		{
+			__m128d b_0 = _mm_loadu_pd(B);
+			__m128d b_1 = _mm_loadu_pd(B + 2);
+
+			for (std::size_t r(0u); r < 2u; ++r)
+			{
+				const double* a = A + r * 2u;
+				__m128d c = _mm_mul_pd(_mm_set1_pd(a[0]), b_0);
+				c = _mm_add_pd(c, _mm_mul_pd(_mm_set1_pd(a[1]), b_1));
+				_mm_storeu_pd(C + r * 2u, c);
+			}
+		}
+
+		// The first two columns are computed in a vector, the third on its own.
+		inline void multiply_3x3(const double* A, const double* B, double* C)
+		{
+			__m128d b_0 = _mm_loadu_pd(B);
+			__m128d b_1 = _mm_loadu_pd(B + 3);
+			__m128d b_2 = _mm_loadu_pd(B + 6);
+
+			for (std::size_t r(0u); r < 3u; ++r)
+			{
+				const double* a = A + r * 3u;
+				__m128d c = _mm_mul_pd(_mm_set1_pd(a[0]), b_0);
+				c = _mm_add_pd(c, _mm_mul_pd(_mm_set1_pd(a[1]), b_1));
+				c = _mm_add_pd(c, _mm_mul_pd(_mm_set1_pd(a[2]), b_2));
+				_mm_storeu_pd(C + r * 3u, c);
+				C[r * 3u + 2u] = a[0] * B[2] + a[1] * B[5] + a[2] * B[8];
+			}
+		}
+
+		inline void multiply_4x4(const double* A, const double* B, double* C)
+		{
+			#if defined(SFML_MATRIX_AVX)
+
+			__m256d b_0 = _mm256_loadu_pd(B);
+			__m256d b_1 = _mm256_loadu_pd(B + 4);
+			__m256d b_2 = _mm256_loadu_pd(B + 8);
+			__m256d b_3 = _mm256_loadu_pd(B + 12);
+
+			for (std::size_t r(0u); r < 4u; ++r)
+			{
+				const double* a = A + r * 4u;
+				__m256d c = _mm256_mul_pd(_mm256_set1_pd(a[0]), b_0);
+				c = _mm256_add_pd(c, _mm256_mul_pd(_mm256_set1_pd(a[1]), b_1));
+				c = _mm256_add_pd(c, _mm256_mul_pd(_mm256_set1_pd(a[2]), b_2));
+				c = _mm256_add_pd(c, _mm256_mul_pd(_mm256_set1_pd(a[3]), b_3));
+				_mm256_storeu_pd(C + r * 4u, c);
+			}
+
+			#else
+
+			// Each row is done as two halves of two columns.
+			for (std::size_t half(0u); half < 4u; half += 2u)
+			{
+				__m128d b_0 = _mm_loadu_pd(B + half);
+				__m128d b_1 = _mm_loadu_pd(B + 4 + half);
+				__m128d b_2 = _mm_loadu_pd(B + 8 + half);
+				__m128d b_3 = _mm_loadu_pd(B + 12 + half);
+
+				for (std::size_t r(0u); r < 4u; ++r)
+				{
+					const double* a = A + r * 4u;
+					__m128d c = _mm_mul_pd(_mm_set1_pd(a[0]), b_0);
+					c = _mm_add_pd(c, _mm_mul_pd(_mm_set1_pd(a[1]), b_1));
+					c = _mm_add_pd(c, _mm_mul_pd(_mm_set1_pd(a[2]), b_2));
+					c = _mm_add_pd(c, _mm_mul_pd(_mm_set1_pd(a[3]), b_3));
+					_mm_storeu_pd(C + r * 4u + half, c);
+				}
+			}
+
+			#endif
+		}
+
+		#endif // SFML_MATRIX_SSE2
+
+		// True if the product of a Y by X Matrix and an X by Z Matrix
+		// of T has a SIMD kernel.
+		template <typename T, std::size_t X, std::size_t Y, std::size_t Z>
+		constexpr bool has_simd_product()
+		{
+			#if defined(SFML_MATRIX_SSE2)
+			return (std::is_same_v<T, float> || std::is_same_v<T, double>)
+				&& X == Y && Y == Z && X >= 2u && X <= 4u
+				&& sizeof(::sf::Matrix<T, X, X>) == X * X * sizeof(T);
+			#else
+			return false;
+			#endif
+		}
+	}
+
+	namespace priv
+	{
+		// Matrix lvalues are held by reference. Temporaries, including other
+		// expressions, are held by value, so that an expression never refers
+		// to an object that died before it.
+		template <typename E>
+		using expression_operand = std::conditional_t<std::is_lvalue_reference_v<E>,
+			const std::remove_reference_t<E>&, std::remove_cvref_t<E>>;
+
+		//
+		struct Add
+		{
+			template <typename T>
+			constexpr T operator () (const T& a, const T& b) const
+			{
+				return a + b;
+			}
 		};
 
-		Matrix<T, 2, 2> B
+		//
+		struct Subtract
 		{
-			{ M(0, 1), M(2, 1) },
-			{ M(0, 2), M(2, 2) }
+			template <typename T>
+			constexpr T operator () (const T& a, const T& b) const
+			{
+				return a - b;
+			}
 		};
 
-		Matrix<T, 2, 2> X
+		// Casts back to T, as Matrix::operator *= does.
+		struct Multiply
 		{
-			{ M(0, 1), M(1, 1) },
-			{ M(0, 2), M(1, 2) }
+			template <typename T, typename U>
+			constexpr T operator () (const T& a, const U& b) const
+			{
+				return static_cast<T>(a * b);
+			}
 		};
 
-		return (M(0, 0) * determinant(A)) - (M(1, 0) * determinant(B)) + (M(2, 0) * determinant(X));
+		// Casts back to T, as Matrix::operator /= does.
+		struct Divide
+		{
+			template <typename T, typename U>
+			constexpr T operator () (const T& a, const U& b) const
+			{
+				return static_cast<T>(a / b);
+			}
+		};
 	}
-}
 
-template <sf::arithmetic T, std::size_t X, std::size_t Y>
-sf::Matrix<T, X, Y> operator + (const sf::Matrix<T, X, Y>& A, const sf::Matrix<T, X, Y>& B)
-{
-	sf::Matrix<T, X, Y> M;
+	// The lazy result of an element-wise operator on two matrix expressions.
+	// Nothing is computed until an element is read, so a chain of operators
+	// builds one nested expression that a Matrix evaluates in a single loop.
+	template <typename L, typename R, typename Op> class MatrixBinaryExpression
+	{
+		L left_;
+		R right_;
+
+		public:
+
+		using value_type = typename std::remove_cvref_t<L>::value_type;
+
+		static constexpr bool is_matrix_expression = true;
+		static constexpr std::size_t col_count = std::remove_cvref_t<L>::col_count;
+		static constexpr std::size_t row_count = std::remove_cvref_t<L>::row_count;
+
+		//
+		template <typename A, typename B>
+		constexpr MatrixBinaryExpression(A&& left, B&& right)
+			: left_(std::forward<A>(left)), right_(std::forward<B>(right)) {}
+
+		//
+		constexpr value_type operator () (std::size_t x, std::size_t y) const
+		{
+			return Op()(left_(x, y), right_(x, y));
+		}
+	};
+
+	// The lazy result of an element-wise operator between a matrix expression and a scalar.
+	template <typename E, arithmetic U, typename Op> class MatrixScalarExpression
+	{
+		E expression_;
+		U scalar_;
 
-	for (std::size_t r(0u); r < Y; ++r)
+		public:
+
+		using value_type = typename std::remove_cvref_t<E>::value_type;
+
+		static constexpr bool is_matrix_expression = true;
+		static constexpr std::size_t col_count = std::remove_cvref_t<E>::col_count;
+		static constexpr std::size_t row_count = std::remove_cvref_t<E>::row_count;
+
+		//
+		template <typename A>
+		constexpr MatrixScalarExpression(A&& expression, U scalar)
+			: expression_(std::forward<A>(expression)), scalar_(scalar) {}
+
+		//
+		constexpr value_type operator () (std::size_t x, std::size_t y) const
+		{
+			return Op()(expression_(x, y), scalar_);
+		}
+	};
+
+	// Element-wise operators return expressions rather than a Matrix.
+	// Assign the result to a Matrix to evaluate it. Storing it in an auto
+	// variable keeps it lazy, and every later read recomputes it.
+
+	template <matrix_expression L, matrix_expression R> requires priv::same_shape<L, R>
+	constexpr auto operator + (L&& A, R&& B)
 	{
-		for (std::size_t c(0u); c < X; ++c)
-			M(r, c) = A(r, c) + B(r, c);
+		return MatrixBinaryExpression<priv::expression_operand<L>, priv::expression_operand<R>, priv::Add>
+			(std::forward<L>(A), std::forward<R>(B));
 	}
 
-	return M;
-}
+	template <matrix_expression L, matrix_expression R> requires priv::same_shape<L, R>
+	constexpr auto operator - (L&& A, R&& B)
+	{
+		return MatrixBinaryExpression<priv::expression_operand<L>, priv::expression_operand<R>, priv::Subtract>
+			(std::forward<L>(A), std::forward<R>(B));
+	}
 
-template <sf::arithmetic T, std::size_t X, std::size_t Y>
-sf::Matrix<T, X, Y> operator - (const sf::Matrix<T, X, Y>& A, const sf::Matrix<T, X, Y>& B)
-{
-	sf::Matrix<T, X, Y> M;
+	template <matrix_expression E, arithmetic U>
+	constexpr auto operator * (E&& A, U scalar)
+	{
+		return MatrixScalarExpression<priv::expression_operand<E>, U, priv::Multiply>(std::forward<E>(A), scalar);
+	}
 
-	for (std::size_t r(0u); r < Y; ++r)
+	template <arithmetic U, matrix_expression E>
+	constexpr auto operator * (U scalar, E&& A)
 	{
-		for (std::size_t c(0u); c < X; ++c)
-			M(r, c) = A(r, c) - B(r, c);
+		return MatrixScalarExpression<priv::expression_operand<E>, U, priv::Multiply>(std::forward<E>(A), scalar);
 	}
 
-	return M;
-}
+	template <matrix_expression E, arithmetic U>
+	constexpr auto operator / (E&& A, U scalar)
+	{
+		return MatrixScalarExpression<priv::expression_operand<E>, U, priv::Divide>(std::forward<E>(A), scalar);
+	}
 
-template <sf::arithmetic T, sf::arithmetic U, std::size_t X, std::size_t Y>
-sf::Matrix<T, X, Y> operator * (const sf::Matrix<T, X, Y>& A, U scalar)
-{
-	sf::Matrix<T, X, Y> M(A);
-	M *= scalar;
+	// Matrix product. A has X columns and Y rows, B has Z columns and X rows.
+	// Square float and double matrices of size 2, 3 and 4 use SIMD kernels,
+	// except during constant evaluation.
+	template <arithmetic T, std::size_t X, std::size_t Y, std::size_t Z>
+	constexpr Matrix<T, Z, Y> operator * (const Matrix<T, X, Y>& A, const Matrix<T, Z, X>& B)
+	{
+		#if defined(SFML_MATRIX_SSE2)
+		if constexpr (priv::has_simd_product<T, X, Y, Z>())
+		{
+			if (!std::is_constant_evaluated())
+			{
+				Matrix<T, Z, Y> M;
 
-	return M;
-}
+				if constexpr (X == 2u)
+					priv::multiply_2x2(A.data(), B.data(), M.data());
+				else if constexpr (X == 3u)
+					priv::multiply_3x3(A.data(), B.data(), M.data());
+				else
+					priv::multiply_4x4(A.data(), B.data(), M.data());
 
-template <sf::arithmetic T, sf::arithmetic U, std::size_t X, std::size_t Y>
-sf::Matrix<T, X, Y> operator / (const sf::Matrix<T, X, Y>& A, U scalar)
-{
-	sf::Matrix<T, X, Y> M(A);
-	M /= scalar;
+				return M;
+			}
+		}
+		#endif
+
+		Matrix<T, Z, Y> M(static_cast<T>(0));
+
+		for (std::size_t r(0u); r < Y; ++r)
+		{
+			for (std::size_t k(0u); k < X; ++k)
+			{
+				T a = A(k, r);
+
+				for (std::size_t c(0u); c < Z; ++c)
+					M(c, r) += a * B(c, k);
+			}
+		}
+
+		return M;
+	}
+
+	// Matrix product of expressions. Each side is evaluated into a Matrix first,
+	// since every element of the product reads a whole row and column.
+	template <matrix_expression L, matrix_expression R>
+		requires (!(priv::is_matrix<std::remove_cvref_t<L>>::value && priv::is_matrix<std::remove_cvref_t<R>>::value)
+			&& std::remove_cvref_t<L>::col_count == std::remove_cvref_t<R>::row_count
+			&& std::same_as<typename std::remove_cvref_t<L>::value_type, typename std::remove_cvref_t<R>::value_type>)
+	constexpr auto operator * (const L& A, const R& B)
+	{
+		using LM = std::remove_cvref_t<L>;
+		using RM = std::remove_cvref_t<R>;
+		using T = typename LM::value_type;
+
+		return Matrix<T, LM::col_count, LM::row_count>(A) * Matrix<T, RM::col_count, RM::row_count>(B);
+	}
+
+	// Matrix-vector product. v is treated as a column.
+	template <arithmetic T, std::size_t X, std::size_t Y>
+	constexpr std::array<T, Y> operator * (const Matrix<T, X, Y>& A, const std::array<T, X>& v)
+	{
+		std::array<T, Y> result{};
+
+		for (std::size_t r(0u); r < Y; ++r)
+		{
+			for (std::size_t c(0u); c < X; ++c)
+				result[r] += A(c, r) * v[c];
+		}
+
+		return result;
+	}
+
+	//
+	template <arithmetic T>
+	constexpr Vector2<T> operator * (const Matrix<T, 2, 2>& A, const Vector2<T>& v)
+	{
+		return Vector2<T>(A(0, 0) * v.x + A(1, 0) * v.y,
+		                  A(0, 1) * v.x + A(1, 1) * v.y);
+	}
+
+	//
+	template <arithmetic T>
+	constexpr Vector3<T> operator * (const Matrix<T, 3, 3>& A, const Vector3<T>& v)
+	{
+		return Vector3<T>(A(0, 0) * v.x + A(1, 0) * v.y + A(2, 0) * v.z,
+		                  A(0, 1) * v.x + A(1, 1) * v.y + A(2, 1) * v.z,
+		                  A(0, 2) * v.x + A(1, 2) * v.y + A(2, 2) * v.z);
+	}
+
+	// LU decomposition with partial pivoting of a square Matrix M:
+	// the rows of M, reordered by pivot, equal L * U.
+	// U is stored on and above the diagonal of LU, and L below it,
+	// with the ones on the diagonal of L left out.
+	template <std::floating_point T, std::size_t N> struct LUDecomposition
+	{
+		Matrix<T, N, N> LU;
+		std::array<std::size_t, N> pivot;
+		T sign;
+		bool singular;
+
+		//
+		constexpr T determinant() const
+		{
+			if (singular)
+				return static_cast<T>(0);
+
+			T det = sign;
+
+			for (std::size_t i(0u); i < N; ++i)
+				det *= LU(i, i);
+
+			return det;
+		}
+
+		// Returns x such that M * x = b.
+		// Throws std::domain_error if M is singular.
+		constexpr std::array<T, N> solve(const std::array<T, N>& b) const
+		{
+			if (singular)
+				throw std::domain_error("Matrix is singular");
+
+			std::array<T, N> x{};
+
+			// Forward substitution with L, taking the rows of b in pivot order.
+			for (std::size_t r(0u); r < N; ++r)
+			{
+				T sum = b[pivot[r]];
+
+				for (std::size_t c(0u); c < r; ++c)
+					sum -= LU(c, r) * x[c];
+
+				x[r] = sum;
+			}
+
+			// Back substitution with U.
+			for (std::size_t r(N); r-- > 0u;)
+			{
+				T sum = x[r];
+
+				for (std::size_t c(r + 1u); c < N; ++c)
+					sum -= LU(c, r) * x[c];
+
+				x[r] = sum / LU(r, r);
+			}
+
+			return x;
+		}
 
-	return M;
+		// Returns X such that M * X = B, solving for every column of B.
+		// Throws std::domain_error if M is singular.
+		template <std::size_t K>
+		constexpr Matrix<T, K, N> solve(const Matrix<T, K, N>& B) const
+		{
+			Matrix<T, K, N> X(static_cast<T>(0));
+
+			for (std::size_t k(0u); k < K; ++k)
+			{
+				std::array<T, N> x = solve(B.getCol(k));
+
+				for (std::size_t r(0u); r < N; ++r)
+					X(k, r) = x[r];
+			}
+
+			return X;
+		}
+
+		// Throws std::domain_error if M is singular.
+		constexpr Matrix<T, N, N> inverse() const
+		{
+			return solve(Matrix<T, N, N>::identity());
+		}
+	};
+
+	// Decomposes M into LU form, choosing the largest remaining pivot in each column.
+	template <std::floating_point T, std::size_t N>
+	constexpr LUDecomposition<T, N> lu_decompose(const Matrix<T, N, N>& M)
+	{
+		LUDecomposition<T, N> D{ M, {}, static_cast<T>(1), false };
+		Matrix<T, N, N>& LU = D.LU;
+
+		for (std::size_t i(0u); i < N; ++i)
+			D.pivot[i] = i;
+
+		for (std::size_t k(0u); k < N; ++k)
+		{
+			std::size_t p = k;
+			T largest = LU(k, k) < static_cast<T>(0) ? -LU(k, k) : LU(k, k);
+
+			for (std::size_t r(k + 1u); r < N; ++r)
+			{
+				T value = LU(k, r) < static_cast<T>(0) ? -LU(k, r) : LU(k, r);
+
+				if (value > largest)
+				{
+					largest = value;
+					p = r;
+				}
+			}
+
+			if (largest == static_cast<T>(0))
+			{
+				D.singular = true;
+				continue;
+			}
+
+			if (p != k)
+			{
+				for (std::size_t c(0u); c < N; ++c)
+					std::swap(LU(c, k), LU(c, p));
+
+				std::swap(D.pivot[k], D.pivot[p]);
+				D.sign = -D.sign;
+			}
+
+			for (std::size_t r(k + 1u); r < N; ++r)
+			{
+				T factor = LU(k, r) / LU(k, k);
+				LU(k, r) = factor;
+
+				for (std::size_t c(k + 1u); c < N; ++c)
+					LU(c, r) -= factor * LU(c, k);
+			}
+		}
+
+		return D;
+	}
+
+	// Sizes up to 4 use closed forms. Larger sizes use lu_decompose(),
+	// so they need a floating point type.
+	template <arithmetic T, std::size_t N> requires (N <= 4u || std::floating_point<T>)
+	constexpr T determinant(const Matrix<T, N, N>& M)
+	{
+		if constexpr (N == 1u)
+			return M(0, 0);
+		else if constexpr (N == 2u)
+			return (M(0, 0) * M(1, 1)) - (M(0, 1) * M(1, 0));
+		else if constexpr (N == 3u)
+		{
+			return M(0, 0) * (M(1, 1) * M(2, 2) - M(2, 1) * M(1, 2))
+			     - M(1, 0) * (M(0, 1) * M(2, 2) - M(2, 1) * M(0, 2))
+			     + M(2, 0) * (M(0, 1) * M(1, 2) - M(1, 1) * M(0, 2));
+		}
+		else if constexpr (N == 4u)
+		{
+			// Expands along the top two rows, sharing their 2x2 minors
+			// with the matching minors of the bottom two rows.
+			T s0 = M(0, 0) * M(1, 1) - M(1, 0) * M(0, 1);
+			T s1 = M(0, 0) * M(2, 1) - M(2, 0) * M(0, 1);
+			T s2 = M(0, 0) * M(3, 1) - M(3, 0) * M(0, 1);
+			T s3 = M(1, 0) * M(2, 1) - M(2, 0) * M(1, 1);
+			T s4 = M(1, 0) * M(3, 1) - M(3, 0) * M(1, 1);
+			T s5 = M(2, 0) * M(3, 1) - M(3, 0) * M(2, 1);
+
+			T c5 = M(2, 2) * M(3, 3) - M(3, 2) * M(2, 3);
+			T c4 = M(1, 2) * M(3, 3) - M(3, 2) * M(1, 3);
+			T c3 = M(1, 2) * M(2, 3) - M(2, 2) * M(1, 3);
+			T c2 = M(0, 2) * M(3, 3) - M(3, 2) * M(0, 3);
+			T c1 = M(0, 2) * M(2, 3) - M(2, 2) * M(0, 3);
+			T c0 = M(0, 2) * M(1, 3) - M(1, 2) * M(0, 3);
+
+			return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+		}
+		else
+			return lu_decompose(M).determinant();
+	}
+
+	// Sizes 2 and 3 use the adjugate. Larger sizes use lu_decompose().
+	// Throws std::domain_error if M is singular.
+	template <std::floating_point T, std::size_t N>
+	constexpr Matrix<T, N, N> inverse(const Matrix<T, N, N>& M)
+	{
+		if constexpr (N == 2u || N == 3u)
+		{
+			T det = determinant(M);
+
+			if (det == static_cast<T>(0))
+				throw std::domain_error("Matrix is singular");
+
+			Matrix<T, N, N> R(static_cast<T>(0));
+
+			if constexpr (N == 2u)
+			{
+				R(0, 0) = M(1, 1);
+				R(1, 0) = -M(1, 0);
+				R(0, 1) = -M(0, 1);
+				R(1, 1) = M(0, 0);
+			}
+			else
+			{
+				R(0, 0) = M(1, 1) * M(2, 2) - M(2, 1) * M(1, 2);
+				R(1, 0) = M(2, 0) * M(1, 2) - M(1, 0) * M(2, 2);
+				R(2, 0) = M(1, 0) * M(2, 1) - M(2, 0) * M(1, 1);
+				R(0, 1) = M(2, 1) * M(0, 2) - M(0, 1) * M(2, 2);
+				R(1, 1) = M(0, 0) * M(2, 2) - M(2, 0) * M(0, 2);
+				R(2, 1) = M(2, 0) * M(0, 1) - M(0, 0) * M(2, 1);
+				R(0, 2) = M(0, 1) * M(1, 2) - M(1, 1) * M(0, 2);
+				R(1, 2) = M(1, 0) * M(0, 2) - M(0, 0) * M(1, 2);
+				R(2, 2) = M(0, 0) * M(1, 1) - M(1, 0) * M(0, 1);
+			}
+
+			R *= static_cast<T>(1) / det;
+			return R;
+		}
+		else
+			return lu_decompose(M).inverse();
+	}
+
+	// Returns x such that M * x = b.
+	// Throws std::domain_error if M is singular.
+	template <std::floating_point T, std::size_t N>
+	constexpr std::array<T, N> solve(const Matrix<T, N, N>& M, const std::array<T, N>& b)
+	{
+		if constexpr (N == 2u || N == 3u)
+			return inverse(M) * b;
+		else
+			return lu_decompose(M).solve(b);
+	}
+
+	namespace priv
+	{
+		// An expression other than a Matrix itself, such as A + B * s.
+		template <typename E>
+		concept lazy_expression = matrix_expression<E> && !is_matrix<std::remove_cvref_t<E>>::value;
+
+		// The Matrix that an expression evaluates to.
+		template <typename E>
+		using evaluated_matrix = ::sf::Matrix<typename std::remove_cvref_t<E>::value_type,
+			std::remove_cvref_t<E>::col_count, std::remove_cvref_t<E>::row_count>;
+	}
+
+	// The functions below evaluate an expression into a Matrix once, then
+	// pass it to the overload for a Matrix. Deduction cannot see through
+	// an expression to the Matrix it becomes, so each needs its own.
+
+	//
+	template <priv::lazy_expression E>
+	constexpr auto transpose(const E& expression)
+	{
+		return transpose(priv::evaluated_matrix<E>(expression));
+	}
+
+	//
+	template <priv::lazy_expression E>
+	constexpr auto lu_decompose(const E& expression)
+	{
+		return lu_decompose(priv::evaluated_matrix<E>(expression));
+	}
+
+	//
+	template <priv::lazy_expression E>
+	constexpr auto determinant(const E& expression)
+	{
+		return determinant(priv::evaluated_matrix<E>(expression));
+	}
+
+	//
+	template <priv::lazy_expression E>
+	constexpr auto inverse(const E& expression)
+	{
+		return inverse(priv::evaluated_matrix<E>(expression));
+	}
+
+	//
+	template <priv::lazy_expression E>
+	constexpr auto solve(const E& expression, const std::array<typename std::remove_cvref_t<E>::value_type, std::remove_cvref_t<E>::row_count>& b)
+	{
+		return solve(priv::evaluated_matrix<E>(expression), b);
+	}
 }
 
 #endif // SFML_MATRIX_HPP
\ No newline at end of file
@@ -2,7 +2,7 @@
 // 
 // This is an added file for this modified version of SFML 2.5.1
 // Modified by Justyn Durnford
-// Last modified on 2021-05-11
+// Last modified on 2026-10-17
 // 
 // SFML - Simple and Fast Multimedia Library
 // Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
@@ -31,6 +31,7 @@
 
 #include <cmath>
 #include <string>
+#include <type_traits>
 
 namespace sf
 {
@@ -41,27 +42,19 @@ namespace sf
 		T x;
 		T y;
 
-		// 
-		Point2()
-		{
-			x = static_cast<T>(0);
-			y = static_cast<T>(0);
-		}
+		// Leaves x and y uninitialised, which keeps Point2 trivial: arrays of
+		// them are allocated without being written to. Point2() and Point2{}
+		// are still (0, 0).
+		Point2() = default;
 
 		// 
-		Point2(T X, T Y)
-		{
-			x = X;
-			y = Y;
-		}
+		constexpr Point2(T X, T Y)
+			: x(X), y(Y) {}
 
 		// 
 		template <typename U>
-		explicit Point2(const Point2<U>& other)
-		{
-			x = static_cast<T>(other.x);
-			y = static_cast<T>(other.y);
-		}
+		constexpr explicit Point2(const Point2<U>& other)
+			: x(static_cast<T>(other.x)), y(static_cast<T>(other.y)) {}
 
 		// \brief Returns a std::string representation of the Point2.
 		std::string toString() const
@@ -70,11 +63,33 @@ namespace sf
 		}
 	};
 
+	namespace priv
+	{
+		// The type distances between a Point2<T> and a Point2<U> are measured in:
+		// float if both are float, double otherwise.
+		template <typename T, typename U>
+		using distance_type = std::conditional_t<std::is_same_v<std::common_type_t<T, U>, float>, float, double>;
+	}
+
+	// Returns the squared distance between the two Point2s.
+	// Cheaper than distance_between(), and orders distances the same way.
+	template <typename T, typename U>
+	constexpr priv::distance_type<T, U> squared_distance_between(const Point2<T>& A, const Point2<U>& B)
+	{
+		using R = priv::distance_type<T, U>;
+
+		R x = static_cast<R>(B.x) - static_cast<R>(A.x);
+		R y = static_cast<R>(B.y) - static_cast<R>(A.y);
+
+		return x * x + y * y;
+	}
+
 	// Returns the distance between the two Point2s.
+	// See VectorMath.hpp for distances over whole arrays of Point2f.
 	template <typename T, typename U>
-	double distance_between(const Point2<T>& A, const Point2<U>& B)
+	priv::distance_type<T, U> distance_between(const Point2<T>& A, const Point2<U>& B)
 	{
-		return std::sqrt(std::pow(B.x - A.x, 2) + std::pow(B.y - A.y, 2));
+		return std::sqrt(squared_distance_between(A, B));
 	}
 
 	// Define common types
@@ -85,6 +100,10 @@ namespace sf
 	typedef sf::Point2<int>            Point2i;
 	typedef sf::Point2<unsigned int>   Point2u;
 	typedef sf::Point2<float>          Point2f;
+
+	static_assert(std::is_trivial_v<Point2f>, "Point2f must be trivial");
+	static_assert(std::is_standard_layout_v<Point2f>, "Point2f must be standard layout");
+	static_assert(sizeof(Point2f) == 2u * sizeof(float), "Point2f must be two packed floats");
 }
 
 // Equality comparison operator.
@@ -93,7 +112,7 @@ namespace sf
 //  - A.y == B.y
 // Returns false otherwise.
 template <typename T, typename U>
-bool operator == (const sf::Point2<T>& A, const sf::Point2<U>& B)
+constexpr bool operator == (const sf::Point2<T>& A, const sf::Point2<U>& B)
 {
 	return (A.x == B.x) && (A.y == B.y);
 }
@@ -104,7 +123,7 @@ bool operator == (const sf::Point2<T>& A, const sf::Point2<U>& B)
 //  - A.y != B.y
 // Returns false otherwise.
 template <typename T, typename U>
-bool operator != (const sf::Point2<T>& A, const sf::Point2<U>& B)
+constexpr bool operator != (const sf::Point2<T>& A, const sf::Point2<U>& B)
 {
 	return (A.x != B.x) || (A.y != B.y);
 }
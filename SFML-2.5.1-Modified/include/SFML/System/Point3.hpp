@@ -2,7 +2,7 @@
 // 
 // This is an added file for this modified version of SFML 2.5.1
 // Modified by Justyn Durnford
-// Last modified on 2021-05-11
+// Last modified on 2026-10-17
 // 
 // SFML - Simple and Fast Multimedia Library
 // Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
@@ -29,8 +29,11 @@
 #ifndef SFML_POINT3_HPP
 #define SFML_POINT3_HPP
 
+#include <SFML/System/Point2.hpp>
+
 #include <cmath>
 #include <string>
+#include <type_traits>
 
 namespace sf
 {
@@ -42,30 +45,18 @@ namespace sf
 		T y;
 		T z;
 
-		// 
-		Point3()
-		{
-			x = static_cast<T>(0);
-			y = static_cast<T>(0);
-			z = static_cast<T>(0);
-		}
+		// Leaves x, y and z uninitialised, like Point2().
+		// Point3() and Point3{} are still (0, 0, 0).
+		Point3() = default;
 
 		// 
-		Point3(T X, T Y, T Z)
-		{
-			x = X;
-			y = Y;
-			z = Z;
-		}
+		constexpr Point3(T X, T Y, T Z)
+			: x(X), y(Y), z(Z) {}
 
 		// 
 		template <typename U>
-		explicit Point3(const Point3<U>& other)
-		{
-			x = static_cast<T>(other.x);
-			y = static_cast<T>(other.y);
-			z = static_cast<T>(other.z);
-		}
+		constexpr explicit Point3(const Point3<U>& other)
+			: x(static_cast<T>(other.x)), y(static_cast<T>(other.y)), z(static_cast<T>(other.z)) {}
 
 		// \brief Returns a std::string representation of the Point3.
 		std::string toString() const
@@ -74,11 +65,25 @@ namespace sf
 		}
 	};
 
+	// Returns the squared distance between the two Point3s.
+	// Cheaper than distance_between(), and orders distances the same way.
+	template <typename T, typename U>
+	constexpr priv::distance_type<T, U> squared_distance_between(const Point3<T>& A, const Point3<U>& B)
+	{
+		using R = priv::distance_type<T, U>;
+
+		R x = static_cast<R>(B.x) - static_cast<R>(A.x);
+		R y = static_cast<R>(B.y) - static_cast<R>(A.y);
+		R z = static_cast<R>(B.z) - static_cast<R>(A.z);
+
+		return x * x + y * y + z * z;
+	}
+
 	// Returns the distance between the two Point3s.
 	template <typename T, typename U>
-	double distance_between(const Point3<T>& A, const Point3<U>& B)
+	priv::distance_type<T, U> distance_between(const Point3<T>& A, const Point3<U>& B)
 	{
-		return std::sqrt(std::pow(B.x - A.x, 2) + std::pow(B.y - A.y, 2) + std::pow(B.z - A.z, 2));
+		return std::sqrt(squared_distance_between(A, B));
 	}
 
 	// Define common types
@@ -89,6 +94,10 @@ namespace sf
 	typedef sf::Point3<int>            Point3i;
 	typedef sf::Point3<unsigned int>   Point3u;
 	typedef sf::Point3<float>          Point3f;
+
+	static_assert(std::is_trivial_v<Point3f>, "Point3f must be trivial");
+	static_assert(std::is_standard_layout_v<Point3f>, "Point3f must be standard layout");
+	static_assert(sizeof(Point3f) == 3u * sizeof(float), "Point3f must be three packed floats");
 }
 
 // Equality comparison operator.
@@ -98,7 +107,7 @@ namespace sf
 //  - A.z == B.z
 // Returns false otherwise.
 template <typename T, typename U>
-bool operator == (const sf::Point3<T>& A, const sf::Point3<U>& B)
+constexpr bool operator == (const sf::Point3<T>& A, const sf::Point3<U>& B)
 {
 	return (A.x == B.x) && (A.y == B.y) && (A.z == B.z);
 }
@@ -110,7 +119,7 @@ bool operator == (const sf::Point3<T>& A, const sf::Point3<U>& B)
 //  - A.z != B.z
 // Returns false otherwise.
 template <typename T, typename U>
-bool operator != (const sf::Point3<T>& A, const sf::Point3<U>& B)
+constexpr bool operator != (const sf::Point3<T>& A, const sf::Point3<U>& B)
 {
 	return (A.x != B.x) || (A.y != B.y) || (A.z != B.z);
 }
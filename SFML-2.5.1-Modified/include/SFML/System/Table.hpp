@@ -2,7 +2,7 @@
 // 
 // This is an added file for this modified version of SFML 2.5.1
 // Modified by Justyn Durnford
-// Last modified on 2021-05-19
+// Last modified on 2026-10-16
 // 
 // SFML - Simple and Fast Multimedia Library
 // Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
@@ -30,37 +30,264 @@
 #define SFML_TABLE_HPP
 
 #include <algorithm>
+#include <compare>
 #include <concepts>
 #include <cstddef>
 #include <initializer_list>
+#include <iterator>
+#include <span>
 #include <stdexcept>
 #include <vector>
 
 namespace sf
 {
+	// A random access iterator that steps over stride elements at a time,
+	// such as down a column of a rectangular Table.
+	template <typename T> class StridedIterator
+	{
+		T* ptr_;
+		std::ptrdiff_t stride_;
+
+		public:
+
+		using iterator_concept = std::random_access_iterator_tag;
+		using iterator_category = std::random_access_iterator_tag;
+		using value_type = std::remove_cv_t<T>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = T*;
+		using reference = T&;
+
+		//
+		StridedIterator()
+			: ptr_(nullptr), stride_(1) {}
+
+		//
+		StridedIterator(T* ptr, std::ptrdiff_t stride)
+			: ptr_(ptr), stride_(stride) {}
+
+		//
+		T& operator * () const
+		{
+			return *ptr_;
+		}
+
+		//
+		T* operator -> () const
+		{
+			return ptr_;
+		}
+
+		//
+		T& operator [] (difference_type n) const
+		{
+			return ptr_[n * stride_];
+		}
+
+		//
+		StridedIterator& operator ++ ()
+		{
+			ptr_ += stride_;
+			return *this;
+		}
+
+		//
+		StridedIterator operator ++ (int)
+		{
+			StridedIterator old(*this);
+			ptr_ += stride_;
+			return old;
+		}
+
+		//
+		StridedIterator& operator -- ()
+		{
+			ptr_ -= stride_;
+			return *this;
+		}
+
+		//
+		StridedIterator operator -- (int)
+		{
+			StridedIterator old(*this);
+			ptr_ -= stride_;
+			return old;
+		}
+
+		//
+		StridedIterator& operator += (difference_type n)
+		{
+			ptr_ += n * stride_;
+			return *this;
+		}
+
+		//
+		StridedIterator& operator -= (difference_type n)
+		{
+			ptr_ -= n * stride_;
+			return *this;
+		}
+
+		//
+		friend StridedIterator operator + (StridedIterator it, difference_type n)
+		{
+			return it += n;
+		}
+
+		//
+		friend StridedIterator operator + (difference_type n, StridedIterator it)
+		{
+			return it += n;
+		}
+
+		//
+		friend StridedIterator operator - (StridedIterator it, difference_type n)
+		{
+			return it -= n;
+		}
+
+		//
+		friend difference_type operator - (const StridedIterator& a, const StridedIterator& b)
+		{
+			return (a.ptr_ - b.ptr_) / a.stride_;
+		}
+
+		//
+		friend bool operator == (const StridedIterator& a, const StridedIterator& b)
+		{
+			return a.ptr_ == b.ptr_;
+		}
+
+		//
+		friend std::strong_ordering operator <=> (const StridedIterator& a, const StridedIterator& b)
+		{
+			return a.ptr_ <=> b.ptr_;
+		}
+	};
+
+	// A non-owning view of count elements, stride elements apart.
+	// Like std::span, it is only valid while the storage it views is.
+	template <typename T> class StridedSpan
+	{
+		T* data_;
+		std::size_t size_;
+		std::ptrdiff_t stride_;
+
+		public:
+
+		using value_type = std::remove_cv_t<T>;
+		using size_type = std::size_t;
+		using reference = T&;
+		using iterator = StridedIterator<T>;
+
+		//
+		StridedSpan()
+			: data_(nullptr), size_(0u), stride_(1) {}
+
+		//
+		StridedSpan(T* data, std::size_t size, std::ptrdiff_t stride)
+			: data_(data), size_(size), stride_(stride) {}
+
+		//
+		std::size_t size() const
+		{
+			return size_;
+		}
+
+		//
+		bool empty() const
+		{
+			return size_ == 0u;
+		}
+
+		//
+		std::ptrdiff_t stride() const
+		{
+			return stride_;
+		}
+
+		//
+		T& operator [] (std::size_t i) const
+		{
+			return data_[static_cast<std::ptrdiff_t>(i) * stride_];
+		}
+
+		//
+		iterator begin() const
+		{
+			return iterator(data_, stride_);
+		}
+
+		//
+		iterator end() const
+		{
+			return iterator(data_ + static_cast<std::ptrdiff_t>(size_) * stride_, stride_);
+		}
+	};
+
+	// A table of values in rows, which may differ in length.
+	// Every element is kept in one contiguous buffer, row after row, so that
+	// building a Table makes two allocations however many rows it has, and
+	// scanning it walks memory in order.
+	//
+	// row() returns a view of a row rather than a copy. When every row has
+	// the same length the Table is rectangular, and col() returns a strided
+	// view of a column as well.
 	template <std::semiregular T> class Table
 	{
-		std::vector<std::vector<T>> data_;
+		std::vector<T> data_;
+		std::vector<std::size_t> rowStart_;
+		std::size_t cols_;
 
 		//
 		inline void checkRow(std::size_t r) const
 		{
-			if (r >= data_.size())
+			if (r >= rowCount())
 				throw std::out_of_range("Invalid row index");
 		}
 
 		//
 		inline void checkCol(std::size_t r, std::size_t c) const
 		{
-			if (c >= data_[r].size())
+			if (c >= rowStart_[r + 1u] - rowStart_[r])
 				throw std::out_of_range("Invalid column index");
 		}
 
-		// 
+		//
 		void checkBounds(std::size_t x, std::size_t y) const
 		{
 			checkRow(y);
-			checkCol(x);
+			checkCol(y, x);
+		}
+
+		//
+		void checkRectangular() const
+		{
+			if (cols_ == jagged)
+				throw std::logic_error("Table is not rectangular");
+		}
+
+		//
+		void assign(std::initializer_list<std::initializer_list<T>> list)
+		{
+			std::size_t total = 0u;
+
+			for (const auto& row : list)
+				total += row.size();
+
+			data_.clear();
+			data_.reserve(total);
+			rowStart_.assign(1u, 0u);
+			rowStart_.reserve(list.size() + 1u);
+			cols_ = list.size() == 0u ? 0u : list.begin()->size();
+
+			for (const auto& row : list)
+			{
+				data_.insert(data_.end(), row.begin(), row.end());
+				rowStart_.push_back(data_.size());
+
+				if (row.size() != cols_)
+					cols_ = jagged;
+			}
 		}
 
 		public:
@@ -70,153 +297,199 @@ namespace sf
 		using reference = T&;
 		using const_reference = const T&;
 
-		// 
-		Table() = default;
+		// The column count of a Table whose rows differ in length.
+		static constexpr std::size_t jagged = static_cast<std::size_t>(-1);
 
-		// 
-		Table(std::size_t rows, std::size_t cols)
-		{
-			data_.resize(rows);
-			data_.shrink_to_fit();
+		//
+		Table()
+			: rowStart_(1u, 0u), cols_(0u) {}
 
-			for (std::size_t r = 0; r < rows; ++r)
-			{
-				data_[r].resize(cols);
-				data_[r].shrink_to_fit();
-			}
-		}
+		// Creates a rectangular Table.
+		Table(std::size_t rows, std::size_t cols)
+			: Table(rows, cols, T()) {}
 
-		// 
+		// Creates a rectangular Table with every element set to value.
 		Table(std::size_t rows, std::size_t cols, const T& value)
 		{
-			data_.resize(rows);
-			data_.shrink_to_fit();
-
-			for (std::size_t r = 0; r < rows; ++r)
-			{
-				data_[r].resize(cols, value);
-				data_[r].shrink_to_fit();
-			}
+			resize(rows, cols, value);
 		}
 
-		// 
+		//
 		Table(std::initializer_list<std::initializer_list<T>> list)
 		{
-			data_.resize(list.size());
-			data_.shrink_to_fit();
-			
-			std::size_t r = 0;
-
-			for (const auto& row : list)
-			{
-				data_[r].resize(row.size());
-				data_[r].shrink_to_fit();
-
-				std::copy(row.begin(), row.end(), data_[r].begin());
-				++r;
-			}
+			assign(list);
 		}
 
-		// 
+		//
 		Table(const Table& other) = default;
 
-		// 
+		//
 		Table(Table&& other) = default;
 
-		// 
+		//
 		Table& operator = (std::initializer_list<std::initializer_list<T>> list)
 		{
-			data_.resize(list.size());
-			data_.shrink_to_fit();
-
-			std::size_t r = 0;
-
-			for (const auto& row : list)
-			{
-				data_[r].resize(row.size());
-				data_[r].shrink_to_fit();
-
-				std::copy(row.begin(), row.end(), data_[r].begin());
-				++r;
-			}
-
+			assign(list);
 			return *this;
 		}
 
-		// 
+		//
 		Table& operator = (const Table& other) = default;
 
-		// 
+		//
 		Table& operator = (Table && other) = default;
 
-		// 
+		//
 		~Table() = default;
 
+		// Makes the Table rectangular, with every element set to value.
+		void resize(std::size_t rows, std::size_t cols, const T& value = T())
+		{
+			data_.assign(rows * cols, value);
+			rowStart_.resize(rows + 1u);
+			cols_ = cols;
+
+			for (std::size_t r = 0; r <= rows; ++r)
+				rowStart_[r] = r * cols;
+		}
+
 		//
 		std::size_t rowCount() const
 		{
-			return data_.size();
+			// A Table that was moved from has no row starts at all.
+			return rowStart_.empty() ? 0u : rowStart_.size() - 1u;
 		}
 
-		// 
+		//
 		std::size_t rowSize(std::size_t y) const
 		{
 			checkRow(y);
-			return data_[y].size();
+			return rowStart_[y + 1u] - rowStart_[y];
 		}
 
-		// 
-		std::vector<T> getRow(std::size_t y) const
+		// Returns true if every row has the same length.
+		bool isRectangular() const
+		{
+			return cols_ != jagged;
+		}
+
+		// Returns the length of every row.
+		// Throws std::logic_error if the Table is not rectangular.
+		std::size_t colCount() const
+		{
+			checkRectangular();
+			return cols_;
+		}
+
+		// Returns the total number of elements.
+		std::size_t size() const
+		{
+			return data_.size();
+		}
+
+		// Returns a pointer to the elements, stored row after row.
+		T* data()
+		{
+			return data_.data();
+		}
+
+		// Returns a pointer to the elements, stored row after row.
+		const T* data() const
+		{
+			return data_.data();
+		}
+
+		// Returns a view of row y.
+		std::span<T> row(std::size_t y)
 		{
 			checkRow(y);
-			return data_[y];
+			return std::span<T>(data_.data() + rowStart_[y], rowStart_[y + 1u] - rowStart_[y]);
 		}
 
-		// 
+		// Returns a view of row y.
+		std::span<const T> row(std::size_t y) const
+		{
+			checkRow(y);
+			return std::span<const T>(data_.data() + rowStart_[y], rowStart_[y + 1u] - rowStart_[y]);
+		}
+
+		// Returns a view of column x.
+		// Throws std::logic_error if the Table is not rectangular.
+		StridedSpan<T> col(std::size_t x)
+		{
+			std::size_t cols = colCount();
+
+			if (x >= cols)
+				throw std::out_of_range("Invalid column index");
+
+			return StridedSpan<T>(data_.data() + x, rowCount(), static_cast<std::ptrdiff_t>(cols));
+		}
+
+		// Returns a view of column x.
+		// Throws std::logic_error if the Table is not rectangular.
+		StridedSpan<const T> col(std::size_t x) const
+		{
+			std::size_t cols = colCount();
+
+			if (x >= cols)
+				throw std::out_of_range("Invalid column index");
+
+			return StridedSpan<const T>(data_.data() + x, rowCount(), static_cast<std::ptrdiff_t>(cols));
+		}
+
+		// Returns a copy of row y. Prefer row() unless a copy is needed.
+		std::vector<T> getRow(std::size_t y) const
+		{
+			std::span<const T> view = row(y);
+			return std::vector<T>(view.begin(), view.end());
+		}
+
+		// Returns a copy of column x. Prefer col() unless a copy is needed.
+		// Unlike col(), works for any Table whose every row is long enough.
 		std::vector<T> getCol(std::size_t x) const
 		{
-			std::vector<T> vec(data_.size());
+			std::vector<T> vec(rowCount());
 
-			for (std::size_t r = 0; r < data_.size(); ++r)
+			for (std::size_t r = 0; r < rowCount(); ++r)
 			{
 				checkCol(r, x);
-				vec[r] = data_[r][x];
+				vec[r] = data_[rowStart_[r] + x];
 			}
 
 			return vec;
 		}
 
-		// 
+		//
 		T& at(std::size_t x, std::size_t y)
 		{
 			checkBounds(x, y);
-			return data_[y][x];
+			return data_[rowStart_[y] + x];
 		}
 
-		// 
+		//
 		const T& at(std::size_t x, std::size_t y) const
 		{
 			checkBounds(x, y);
-			return data_[y][x];
+			return data_[rowStart_[y] + x];
 		}
 
-		// 
+		//
 		void set(std::size_t x, std::size_t y, const T& value)
 		{
 			checkBounds(x, y);
-			data_[y][x] = value;
+			data_[rowStart_[y] + x] = value;
 		}
 
-		// 
+		//
 		T& operator () (std::size_t x, std::size_t y)
 		{
-			return data_[y][x];
+			return data_[rowStart_[y] + x];
 		}
 
-		// 
+		//
 		const T& operator () (std::size_t x, std::size_t y) const
 		{
-			return data_[y][x];
+			return data_[rowStart_[y] + x];
 		}
 	};
 }
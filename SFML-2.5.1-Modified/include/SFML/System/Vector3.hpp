@@ -2,7 +2,7 @@
 // 
 // This is a modified version of the SFML 2.5.1 file Vector3.hpp
 // Modified by Justyn Durnford
-// Last modified on 2021-05-11
+// Last modified on 2026-10-17
 // 
 // SFML - Simple and Fast Multimedia Library
 // Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
@@ -46,43 +46,27 @@ namespace sf
         T z;
 
         // \brief Default constructor.
-        // Creates a Vector3(0, 0, 0).
-        Vector3()
-        {
-            x = static_cast<T>(0);
-            y = static_cast<T>(0);
-            z = static_cast<T>(0);
-        }
+        // Leaves x, y and z uninitialised so that Vector3 stays trivial.
+        // Vector3() and Vector3{} still create a Vector3(0, 0, 0).
+        Vector3() = default;
 
         // \brief Constructs the Vector3 from the given coordinates.
         // \param X: X coordinate
         // \param Y: Y coordinate
         // \param Z: Z coordinate
-        Vector3(T X, T Y, T Z)
-        {
-            x = X;
-            y = Y;
-            z = Z;
-        }
+        constexpr Vector3(T X, T Y, T Z)
+            : x(X), y(Y), z(Z) {}
 
         // \brief Constructs the Vector3 from the given Point3.
         // \param P: Point3 to copy the coordinates from 
-        Vector3(const Point3<T>& P)
-        {
-            x = P.x;
-            y = P.y;
-            z = P.z;
-        }
+        constexpr Vector3(const Point3<T>& P)
+            : x(P.x), y(P.y), z(P.z) {}
 
         // \brief Constructs the Vector3 as the displacement vector of the two Point3s.
         // \param A: First Point3
         // \param B: Second Point3
-        Vector3(const Point3<T>& A, const Point3<T>& B)
-        {
-            x = B.x - A.x;
-            y = B.y - A.y;
-            z = B.z - A.z;
-        }
+        constexpr Vector3(const Point3<T>& A, const Point3<T>& B)
+            : x(B.x - A.x), y(B.y - A.y), z(B.z - A.z) {}
 
         // \brief Construct the Vector3 from another type of Vector3.
         //
@@ -93,16 +77,12 @@ namespace sf
         //
         // \param other: Vector3 to convert
         template <typename U>
-        explicit Vector3(const Vector3<U>& other)
-        {
-            x = static_cast<T>(other.x);
-            y = static_cast<T>(other.y);
-            z = static_cast<T>(other.z);
-        }
+        constexpr explicit Vector3(const Vector3<U>& other)
+            : x(static_cast<T>(other.x)), y(static_cast<T>(other.y)), z(static_cast<T>(other.z)) {}
 
         // \brief Assigns the Vector3 from the given Point3.
         // \param P: Point3 to copy the coordinates from 
-        Vector3& operator = (const Point3<T>& P)
+        constexpr Vector3& operator = (const Point3<T>& P)
         {
             x = P.x;
             y = P.y;
@@ -111,14 +91,25 @@ namespace sf
             return *this;
         }
 
+        // \brief Returns the squared magnitude of the Vector3.
+        // Cheaper than magnitude(), and orders magnitudes the same way.
+        constexpr float squaredMagnitude() const
+        {
+            float fx = static_cast<float>(x);
+            float fy = static_cast<float>(y);
+            float fz = static_cast<float>(z);
+
+            return fx * fx + fy * fy + fz * fz;
+        }
+
         // \brief Returns the magnitude of the Vector3.
         float magnitude() const
         {
-            return std::sqrt(std::pow(x, 2) + std::pow(y, 2) + std::pow(z, 2));
+            return std::sqrt(squaredMagnitude());
         }
 
         // \brief Returns the endpoint of the Point3.
-        Point3<T> endpoint() const
+        constexpr Point3<T> endpoint() const
         {
             return Point3<T>(x, y, z);
         }
@@ -139,7 +130,7 @@ namespace sf
 
     // \brief Returns the dot product of the 2 given Vector3s.
     template <typename T, typename U, typename V>
-    T dot_product(const Vector3<U>& A, const Vector3<V>& B)
+    constexpr T dot_product(const Vector3<U>& A, const Vector3<V>& B)
     {
         return static_cast<T>(A.x * B.x + A.y * B.y + A.z * B.z);
     }
@@ -148,15 +139,15 @@ namespace sf
     template <typename T, typename U>
     float scalar_proj(const Vector3<T>& A, const Vector3<U>& B)
     {
-        return dot_product(A, B) / A.magnitude();
+        return dot_product<float>(A, B) / A.magnitude();
     }
 
     // \brief Returns the vector projection of A onto B.
     template <typename T, typename U>
     Vector3<float> vector_proj(const Vector3<T>& A, const Vector3<T>& B)
     {
-        float f = (dot_product(A, B) * 1.f / dot_product(A, A) * 1.f);
-        return Vector3<double>(A.x * f, A.y * f, A.z * f);
+        float f = (dot_product<float>(A, B) * 1.f / dot_product<float>(A, A) * 1.f);
+        return Vector3<float>(A.x * f, A.y * f, A.z * f);
     }
 
     // \brief Determines if the 2 given Vector3s are orthogonal to eachother.
@@ -165,7 +156,7 @@ namespace sf
     template <typename T, typename U>
     bool are_normal(const Vector3<T>& A, const Vector3<U>& B)
     {
-        return dot_product(A, B) == 0.f;
+        return dot_product<float>(A, B) == 0.f;
     }
 
     // Define common types
@@ -176,53 +167,57 @@ namespace sf
     typedef sf::Vector3<int>            Vector3i;
     typedef sf::Vector3<unsigned int>   Vector3u;
     typedef sf::Vector3<float>          Vector3f;
+
+    static_assert(std::is_trivial_v<Vector3f>, "Vector3f must be trivial");
+    static_assert(std::is_standard_layout_v<Vector3f>, "Vector3f must be standard layout");
+    static_assert(sizeof(Vector3f) == 3u * sizeof(float), "Vector3f must be three packed floats");
 }
 
 // \brief Overload of unary operator -
 template <typename T>
-sf::Vector3<T> operator - (const sf::Vector3<T>& A)
+constexpr sf::Vector3<T> operator - (const sf::Vector3<T>& A)
 {
     return sf::Vector3<T>(-A.x, -A.y, -A.z);
 }
 
 // \brief Overload of binary operator +
 template <typename T>
-sf::Vector3<T> operator + (const sf::Vector3<T>& A, const sf::Vector3<T>& B)
+constexpr sf::Vector3<T> operator + (const sf::Vector3<T>& A, const sf::Vector3<T>& B)
 {
     return sf::Vector3<T>(A.x + B.x, A.y + B.y, A.z + B.z);
 }
 
 // \brief Overload of binary operator -
 template <typename T>
-sf::Vector3<T> operator - (const sf::Vector3<T>& A, const sf::Vector3<T>& B)
+constexpr sf::Vector3<T> operator - (const sf::Vector3<T>& A, const sf::Vector3<T>& B)
 {
     return sf::Vector3<T>(A.x - B.x, A.y - B.y, A.z - B.z);
 }
 
 // \brief Overload of binary operator *
 template <typename T, typename U>
-sf::Vector3<T> operator * (const sf::Vector3<T>& A, U B)
+constexpr sf::Vector3<T> operator * (const sf::Vector3<T>& A, U B)
 {
     return sf::Vector3<T>(A.x * B, A.y * B, A.z * B);
 }
 
 // \brief Overload of binary operator *
 template <typename T, typename U>
-sf::Vector3<T> operator * (U A, const sf::Vector3<T>& B)
+constexpr sf::Vector3<T> operator * (U A, const sf::Vector3<T>& B)
 {
     return sf::Vector3<T>(B.x * A, B.y * A, B.z * A);
 }
 
 // \brief Overload of binary operator /
 template <typename T, typename U>
-sf::Vector3<T> operator / (const sf::Vector3<T>& A, U B)
+constexpr sf::Vector3<T> operator / (const sf::Vector3<T>& A, U B)
 {
     return sf::Vector3<T>(A.x / B, A.y / B, A.z / B);
 }
 
 // \brief Overload of binary operator +=
 template <typename T>
-sf::Vector3<T>& operator += (sf::Vector3<T>& A, const sf::Vector3<T>& B)
+constexpr sf::Vector3<T>& operator += (sf::Vector3<T>& A, const sf::Vector3<T>& B)
 {
     A.x += B.x;
     A.y += B.y;
@@ -233,7 +228,7 @@ sf::Vector3<T>& operator += (sf::Vector3<T>& A, const sf::Vector3<T>& B)
 
 // \brief Overload of binary operator -=
 template <typename T>
-sf::Vector3<T>& operator -= (sf::Vector3<T>& A, const sf::Vector3<T>& B)
+constexpr sf::Vector3<T>& operator -= (sf::Vector3<T>& A, const sf::Vector3<T>& B)
 {
     A.x -= B.x;
     A.y -= B.y;
@@ -244,7 +239,7 @@ sf::Vector3<T>& operator -= (sf::Vector3<T>& A, const sf::Vector3<T>& B)
 
 // \brief Overload of binary operator *=
 template <typename T, typename U>
-sf::Vector3<T>& operator *= (sf::Vector3<T>& A, U B)
+constexpr sf::Vector3<T>& operator *= (sf::Vector3<T>& A, U B)
 {
     A.x *= B;
     A.y *= B;
@@ -255,7 +250,7 @@ sf::Vector3<T>& operator *= (sf::Vector3<T>& A, U B)
 
 // \brief Overload of binary operator /=
 template <typename T, typename U>
-sf::Vector3<T>& operator /= (sf::Vector3<T>& A, U B)
+constexpr sf::Vector3<T>& operator /= (sf::Vector3<T>& A, U B)
 {
     A.x /= B;
     A.y /= B;
@@ -266,14 +261,14 @@ sf::Vector3<T>& operator /= (sf::Vector3<T>& A, U B)
 
 // \brief Overload of binary operator ==
 template <typename T, typename U>
-bool operator == (const sf::Vector3<T>& A, const sf::Vector3<U>& B)
+constexpr bool operator == (const sf::Vector3<T>& A, const sf::Vector3<U>& B)
 {
     return (A.x == B.x) && (A.y == B.y) && (A.z == B.z);
 }
 
 // \brief Overload of binary operator !=
 template <typename T, typename U>
-bool operator != (const sf::Vector3<T>& A, const sf::Vector3<U>& B)
+constexpr bool operator != (const sf::Vector3<T>& A, const sf::Vector3<U>& B)
 {
     return (A.x != B.x) || (A.y != B.y) || (A.z != B.z);
 }
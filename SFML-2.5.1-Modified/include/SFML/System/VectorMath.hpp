@@ -0,0 +1,665 @@
+////////////////////////////////////////////////////////////
+// 
+// This is an added file for this modified version of SFML 2.5.1
+// Modified by Justyn Durnford
+// Last modified on 2026-10-17
+// 
+// SFML - Simple and Fast Multimedia Library
+// Copyright (X) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_VECTORMATH_HPP
+#define SFML_VECTORMATH_HPP
+
+#include <SFML/System/Point2.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__AVX__)
+	#define SFML_VECTORMATH_AVX
+	#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define SFML_VECTORMATH_SSE2
+	#include <emmintrin.h>
+#endif
+
+// Keeps the compiler from contracting a * b + c into a fused multiply-add,
+// which rounds once instead of twice and so gives results that depend on
+// whether the target has FMA. Code between the two must not rely on any
+// other floating point pragma, which the GCC and Clang forms also restore.
+#if defined(__clang__)
+	#define SFML_VECTORMATH_CONTRACT_OFF _Pragma("float_control(push)") _Pragma("clang fp contract(off)")
+	#define SFML_VECTORMATH_CONTRACT_RESTORE _Pragma("float_control(pop)")
+#elif defined(__GNUC__)
+	#define SFML_VECTORMATH_CONTRACT_OFF _Pragma("GCC push_options") _Pragma("GCC optimize(\"fp-contract=off\")")
+	#define SFML_VECTORMATH_CONTRACT_RESTORE _Pragma("GCC pop_options")
+#elif defined(_MSC_VER) && defined(_M_FP_CONTRACT)
+	#define SFML_VECTORMATH_CONTRACT_OFF __pragma(fp_contract(off))
+	#define SFML_VECTORMATH_CONTRACT_RESTORE __pragma(fp_contract(on))
+#elif defined(_MSC_VER)
+	#define SFML_VECTORMATH_CONTRACT_OFF __pragma(fp_contract(off))
+	#define SFML_VECTORMATH_CONTRACT_RESTORE
+#else
+	#define SFML_VECTORMATH_CONTRACT_OFF
+	#define SFML_VECTORMATH_CONTRACT_RESTORE
+#endif
+
+// Batch operations over arrays of Point2f and Vector2f, such as the
+// distances from thousands of agents to a target every frame.
+//
+// Every operation works in float throughout and processes eight elements
+// at a time with AVX, or four with SSE2, handling whatever does not fill
+// a register one element at a time. The packed and single paths perform
+// the same IEEE operations in the same order, and contraction into fused
+// multiply-adds is turned off for GCC, Clang and MSVC, so results do not
+// depend on which path an element took, nor on the instruction set.
+// Options that let the compiler reorder operations, such as -ffast-math
+// or /fp:fast, void this.
+
+SFML_VECTORMATH_CONTRACT_OFF
+
+namespace sf
+{
+	namespace priv
+	{
+		static_assert(sizeof(Point2f) == 2u * sizeof(float), "Point2f must be two packed floats");
+		static_assert(sizeof(Vector2f) == 2u * sizeof(float), "Vector2f must be two packed floats");
+
+		//
+		inline const float* floats(std::span<const Point2f> points)
+		{
+			return reinterpret_cast<const float*>(points.data());
+		}
+
+		//
+		inline const float* floats(std::span<const Vector2f> vectors)
+		{
+			return reinterpret_cast<const float*>(vectors.data());
+		}
+
+		//
+		inline float* floats(std::span<Vector2f> vectors)
+		{
+			return reinterpret_cast<float*>(vectors.data());
+		}
+
+		//
+		template <typename T, typename U>
+		void check_sizes(std::span<T> input, std::span<U> output)
+		{
+			if (input.size() != output.size())
+				throw std::invalid_argument("Input and output differ in size");
+		}
+
+		// A thin layer over the widest instruction set available,
+		// so that each kernel below is only written once.
+		namespace simd
+		{
+			#if defined(SFML_VECTORMATH_AVX)
+
+				#define SFML_VECTORMATH_SIMD
+
+				using pack = __m256;
+				constexpr std::size_t pack_width = 8u;
+
+				inline pack broadcast(float f) { return _mm256_set1_ps(f); }
+				inline pack load(const float* p) { return _mm256_loadu_ps(p); }
+				inline pack add(pack a, pack b) { return _mm256_add_ps(a, b); }
+				inline pack sub(pack a, pack b) { return _mm256_sub_ps(a, b); }
+				inline pack mul(pack a, pack b) { return _mm256_mul_ps(a, b); }
+				inline pack div(pack a, pack b) { return _mm256_div_ps(a, b); }
+				inline pack sqrt(pack a) { return _mm256_sqrt_ps(a); }
+				inline pack min(pack a, pack b) { return _mm256_min_ps(a, b); }
+				inline pack equal(pack a, pack b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+				inline pack less_equal(pack a, pack b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+				inline pack not_equal(pack a, pack b) { return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); }
+				inline pack select(pack mask, pack a, pack b) { return _mm256_blendv_ps(b, a, mask); }
+				inline int bits(pack mask) { return _mm256_movemask_ps(mask); }
+				inline void store(float* p, pack a) { _mm256_storeu_ps(p, a); }
+
+				// Half as many doubles, for callers that need their exactness.
+				using double_pack = __m256d;
+				constexpr std::size_t double_pack_width = 4u;
+
+				inline double_pack broadcast(double d) { return _mm256_set1_pd(d); }
+				inline double_pack load(const double* p) { return _mm256_loadu_pd(p); }
+				inline double_pack add(double_pack a, double_pack b) { return _mm256_add_pd(a, b); }
+				inline double_pack sub(double_pack a, double_pack b) { return _mm256_sub_pd(a, b); }
+				inline double_pack mul(double_pack a, double_pack b) { return _mm256_mul_pd(a, b); }
+				inline double_pack equal(double_pack a, double_pack b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+				inline double_pack less_equal(double_pack a, double_pack b) { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+				inline int bits(double_pack mask) { return _mm256_movemask_pd(mask); }
+				inline void store(double* p, double_pack a) { _mm256_storeu_pd(p, a); }
+
+				// Loads eight (x, y) pairs from p, split into their x and y components.
+				inline void load_pairs(const float* p, pack& x, pack& y)
+				{
+					__m256 a = _mm256_loadu_ps(p);
+					__m256 b = _mm256_loadu_ps(p + 8);
+
+					// Gather pairs 0-1 with 4-5 and 2-3 with 6-7, so that
+					// the shuffles within each half leave x and y in order.
+					__m256 low = _mm256_permute2f128_ps(a, b, 0x20);
+					__m256 high = _mm256_permute2f128_ps(a, b, 0x31);
+
+					x = _mm256_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0));
+					y = _mm256_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1));
+				}
+
+				// Stores eight (x, y) pairs to p from their x and y components.
+				inline void store_pairs(float* p, pack x, pack y)
+				{
+					__m256 low = _mm256_unpacklo_ps(x, y);
+					__m256 high = _mm256_unpackhi_ps(x, y);
+
+					_mm256_storeu_ps(p, _mm256_permute2f128_ps(low, high, 0x20));
+					_mm256_storeu_ps(p + 8, _mm256_permute2f128_ps(low, high, 0x31));
+				}
+
+				//
+				inline float horizontal_min(pack a)
+				{
+					__m128 m = _mm_min_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+					m = _mm_min_ps(m, _mm_movehl_ps(m, m));
+					m = _mm_min_ss(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 1, 1, 1)));
+					return _mm_cvtss_f32(m);
+				}
+
+			#elif defined(SFML_VECTORMATH_SSE2)
+
+				#define SFML_VECTORMATH_SIMD
+
+				using pack = __m128;
+				constexpr std::size_t pack_width = 4u;
+
+				inline pack broadcast(float f) { return _mm_set1_ps(f); }
+				inline pack load(const float* p) { return _mm_loadu_ps(p); }
+				inline pack add(pack a, pack b) { return _mm_add_ps(a, b); }
+				inline pack sub(pack a, pack b) { return _mm_sub_ps(a, b); }
+				inline pack mul(pack a, pack b) { return _mm_mul_ps(a, b); }
+				inline pack div(pack a, pack b) { return _mm_div_ps(a, b); }
+				inline pack sqrt(pack a) { return _mm_sqrt_ps(a); }
+				inline pack min(pack a, pack b) { return _mm_min_ps(a, b); }
+				inline pack equal(pack a, pack b) { return _mm_cmpeq_ps(a, b); }
+				inline pack less_equal(pack a, pack b) { return _mm_cmple_ps(a, b); }
+				inline pack not_equal(pack a, pack b) { return _mm_cmpneq_ps(a, b); }
+				inline pack select(pack mask, pack a, pack b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+				inline int bits(pack mask) { return _mm_movemask_ps(mask); }
+				inline void store(float* p, pack a) { _mm_storeu_ps(p, a); }
+
+				// Half as many doubles, for callers that need their exactness.
+				using double_pack = __m128d;
+				constexpr std::size_t double_pack_width = 2u;
+
+				inline double_pack broadcast(double d) { return _mm_set1_pd(d); }
+				inline double_pack load(const double* p) { return _mm_loadu_pd(p); }
+				inline double_pack add(double_pack a, double_pack b) { return _mm_add_pd(a, b); }
+				inline double_pack sub(double_pack a, double_pack b) { return _mm_sub_pd(a, b); }
+				inline double_pack mul(double_pack a, double_pack b) { return _mm_mul_pd(a, b); }
+				inline double_pack equal(double_pack a, double_pack b) { return _mm_cmpeq_pd(a, b); }
+				inline double_pack less_equal(double_pack a, double_pack b) { return _mm_cmple_pd(a, b); }
+				inline int bits(double_pack mask) { return _mm_movemask_pd(mask); }
+				inline void store(double* p, double_pack a) { _mm_storeu_pd(p, a); }
+
+				// Loads four (x, y) pairs from p, split into their x and y components.
+				inline void load_pairs(const float* p, pack& x, pack& y)
+				{
+					__m128 a = _mm_loadu_ps(p);
+					__m128 b = _mm_loadu_ps(p + 4);
+
+					x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+					y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+				}
+
+				// Stores four (x, y) pairs to p from their x and y components.
+				inline void store_pairs(float* p, pack x, pack y)
+				{
+					_mm_storeu_ps(p, _mm_unpacklo_ps(x, y));
+					_mm_storeu_ps(p + 4, _mm_unpackhi_ps(x, y));
+				}
+
+				//
+				inline float horizontal_min(pack a)
+				{
+					__m128 m = _mm_min_ps(a, _mm_movehl_ps(a, a));
+					m = _mm_min_ss(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 1, 1, 1)));
+					return _mm_cvtss_f32(m);
+				}
+
+			#endif
+		}
+
+		// Writes the squared distance from origin to each point to out,
+		// then its square root if root is true.
+		inline void distances_from(std::span<const Point2f> points, const Point2f& origin, std::span<float> out, bool root)
+		{
+			check_sizes(points, out);
+
+			const float* p = floats(points);
+			std::size_t n = points.size();
+			std::size_t i = 0u;
+
+			#if defined(SFML_VECTORMATH_SIMD)
+
+			simd::pack ox = simd::broadcast(origin.x);
+			simd::pack oy = simd::broadcast(origin.y);
+
+			for (; i + simd::pack_width <= n; i += simd::pack_width)
+			{
+				simd::pack x, y;
+				simd::load_pairs(p + 2u * i, x, y);
+
+				x = simd::sub(x, ox);
+				y = simd::sub(y, oy);
+
+				simd::pack d = simd::add(simd::mul(x, x), simd::mul(y, y));
+				simd::store(out.data() + i, root ? simd::sqrt(d) : d);
+			}
+
+			#endif
+
+			for (; i < n; ++i)
+			{
+				float x = p[2u * i] - origin.x;
+				float y = p[2u * i + 1u] - origin.y;
+				float d = x * x + y * y;
+
+				out[i] = root ? std::sqrt(d) : d;
+			}
+		}
+
+		// Writes the squared distance between each pair of points to out,
+		// then its square root if root is true.
+		inline void distances_between(std::span<const Point2f> A, std::span<const Point2f> B, std::span<float> out, bool root)
+		{
+			check_sizes(A, B);
+			check_sizes(A, out);
+
+			const float* a = floats(A);
+			const float* b = floats(B);
+			std::size_t n = A.size();
+			std::size_t i = 0u;
+
+			#if defined(SFML_VECTORMATH_SIMD)
+
+			for (; i + simd::pack_width <= n; i += simd::pack_width)
+			{
+				simd::pack ax, ay, bx, by;
+				simd::load_pairs(a + 2u * i, ax, ay);
+				simd::load_pairs(b + 2u * i, bx, by);
+
+				simd::pack x = simd::sub(bx, ax);
+				simd::pack y = simd::sub(by, ay);
+				simd::pack d = simd::add(simd::mul(x, x), simd::mul(y, y));
+
+				simd::store(out.data() + i, root ? simd::sqrt(d) : d);
+			}
+
+			#endif
+
+			for (; i < n; ++i)
+			{
+				float x = b[2u * i] - a[2u * i];
+				float y = b[2u * i + 1u] - a[2u * i + 1u];
+				float d = x * x + y * y;
+
+				out[i] = root ? std::sqrt(d) : d;
+			}
+		}
+
+		// Writes the squared magnitude of each vector to out,
+		// then its square root if root is true.
+		inline void magnitudes_of(std::span<const Vector2f> vectors, std::span<float> out, bool root)
+		{
+			check_sizes(vectors, out);
+
+			const float* v = floats(vectors);
+			std::size_t n = vectors.size();
+			std::size_t i = 0u;
+
+			#if defined(SFML_VECTORMATH_SIMD)
+
+			for (; i + simd::pack_width <= n; i += simd::pack_width)
+			{
+				simd::pack x, y;
+				simd::load_pairs(v + 2u * i, x, y);
+
+				simd::pack d = simd::add(simd::mul(x, x), simd::mul(y, y));
+				simd::store(out.data() + i, root ? simd::sqrt(d) : d);
+			}
+
+			#endif
+
+			for (; i < n; ++i)
+			{
+				float d = v[2u * i] * v[2u * i] + v[2u * i + 1u] * v[2u * i + 1u];
+				out[i] = root ? std::sqrt(d) : d;
+			}
+		}
+
+		// Returns the index of the first point in [first, last) closest to target,
+		// or last if there is none, and sets best to its squared distance.
+		inline std::size_t nearest_in(const float* p, std::size_t first, std::size_t last, const Point2f& target, float& best)
+		{
+			best = std::numeric_limits<float>::infinity();
+			std::size_t i = first;
+
+			#if defined(SFML_VECTORMATH_SIMD)
+
+			// Find the smallest distance first, then where it first occurs,
+			// so that ties go to the lowest index exactly as in the loop below.
+			simd::pack tx = simd::broadcast(target.x);
+			simd::pack ty = simd::broadcast(target.y);
+			simd::pack lowest = simd::broadcast(best);
+
+			for (; i + simd::pack_width <= last; i += simd::pack_width)
+			{
+				simd::pack x, y;
+				simd::load_pairs(p + 2u * i, x, y);
+
+				x = simd::sub(x, tx);
+				y = simd::sub(y, ty);
+
+				// A NaN distance is never picked, as min() returns its second operand.
+				lowest = simd::min(simd::add(simd::mul(x, x), simd::mul(y, y)), lowest);
+			}
+
+			best = simd::horizontal_min(lowest);
+
+			if (best != std::numeric_limits<float>::infinity())
+			{
+				simd::pack wanted = simd::broadcast(best);
+
+				for (std::size_t j = first; j + simd::pack_width <= i; j += simd::pack_width)
+				{
+					simd::pack x, y;
+					simd::load_pairs(p + 2u * j, x, y);
+
+					x = simd::sub(x, tx);
+					y = simd::sub(y, ty);
+
+					int found = simd::bits(simd::equal(simd::add(simd::mul(x, x), simd::mul(y, y)), wanted));
+
+					if (found != 0)
+					{
+						std::size_t index = j;
+
+						while ((found & 1) == 0)
+						{
+							found >>= 1;
+							++index;
+						}
+
+						// The remaining points only replace it if strictly closer.
+						for (; i < last; ++i)
+						{
+							float dx = p[2u * i] - target.x;
+							float dy = p[2u * i + 1u] - target.y;
+							float d = dx * dx + dy * dy;
+
+							if (d < best)
+							{
+								best = d;
+								index = i;
+							}
+						}
+
+						return index;
+					}
+				}
+			}
+
+			#endif
+
+			std::size_t index = last;
+
+			for (; i < last; ++i)
+			{
+				float dx = p[2u * i] - target.x;
+				float dy = p[2u * i + 1u] - target.y;
+				float d = dx * dx + dy * dy;
+
+				if (d < best)
+				{
+					best = d;
+					index = i;
+				}
+			}
+
+			return index;
+		}
+	}
+
+	// Returns the name of the instruction set the batch operations use:
+	// "AVX", "SSE2" or "scalar".
+	inline const char* vector_math_isa()
+	{
+		#if defined(SFML_VECTORMATH_AVX)
+		return "AVX";
+		#elif defined(SFML_VECTORMATH_SSE2)
+		return "SSE2";
+		#else
+		return "scalar";
+		#endif
+	}
+
+	// Sets out[i] to the squared distance from origin to points[i].
+	// Throws std::invalid_argument if points and out differ in size.
+	inline void squared_distances(std::span<const Point2f> points, const Point2f& origin, std::span<float> out)
+	{
+		priv::distances_from(points, origin, out, false);
+	}
+
+	// Sets out[i] to the distance from origin to points[i].
+	// Throws std::invalid_argument if points and out differ in size.
+	inline void distances(std::span<const Point2f> points, const Point2f& origin, std::span<float> out)
+	{
+		priv::distances_from(points, origin, out, true);
+	}
+
+	// Sets out[i] to the squared distance between A[i] and B[i].
+	// Throws std::invalid_argument if A, B and out differ in size.
+	inline void squared_distances(std::span<const Point2f> A, std::span<const Point2f> B, std::span<float> out)
+	{
+		priv::distances_between(A, B, out, false);
+	}
+
+	// Sets out[i] to the distance between A[i] and B[i].
+	// Throws std::invalid_argument if A, B and out differ in size.
+	inline void distances(std::span<const Point2f> A, std::span<const Point2f> B, std::span<float> out)
+	{
+		priv::distances_between(A, B, out, true);
+	}
+
+	// Sets out[i] to the squared magnitude of vectors[i].
+	// Throws std::invalid_argument if vectors and out differ in size.
+	inline void squared_magnitudes(std::span<const Vector2f> vectors, std::span<float> out)
+	{
+		priv::magnitudes_of(vectors, out, false);
+	}
+
+	// Sets out[i] to the magnitude of vectors[i].
+	// Throws std::invalid_argument if vectors and out differ in size.
+	inline void magnitudes(std::span<const Vector2f> vectors, std::span<float> out)
+	{
+		priv::magnitudes_of(vectors, out, true);
+	}
+
+	// Sets out[i] to the dot product of A[i] and B[i].
+	// Throws std::invalid_argument if A, B and out differ in size.
+	inline void dot_products(std::span<const Vector2f> A, std::span<const Vector2f> B, std::span<float> out)
+	{
+		priv::check_sizes(A, B);
+		priv::check_sizes(A, out);
+
+		const float* a = priv::floats(A);
+		const float* b = priv::floats(B);
+		std::size_t n = A.size();
+		std::size_t i = 0u;
+
+		#if defined(SFML_VECTORMATH_SIMD)
+
+		for (; i + priv::simd::pack_width <= n; i += priv::simd::pack_width)
+		{
+			priv::simd::pack ax, ay, bx, by;
+			priv::simd::load_pairs(a + 2u * i, ax, ay);
+			priv::simd::load_pairs(b + 2u * i, bx, by);
+
+			priv::simd::store(out.data() + i, priv::simd::add(priv::simd::mul(ax, bx), priv::simd::mul(ay, by)));
+		}
+
+		#endif
+
+		for (; i < n; ++i)
+			out[i] = a[2u * i] * b[2u * i] + a[2u * i + 1u] * b[2u * i + 1u];
+	}
+
+	// Scales every vector to a magnitude of 1.
+	// Vectors with a magnitude of 0 are left as they are.
+	inline void normalize(std::span<Vector2f> vectors)
+	{
+		float* v = priv::floats(vectors);
+		std::size_t n = vectors.size();
+		std::size_t i = 0u;
+
+		#if defined(SFML_VECTORMATH_SIMD)
+
+		priv::simd::pack zero = priv::simd::broadcast(0.f);
+
+		for (; i + priv::simd::pack_width <= n; i += priv::simd::pack_width)
+		{
+			priv::simd::pack x, y;
+			priv::simd::load_pairs(v + 2u * i, x, y);
+
+			priv::simd::pack m = priv::simd::sqrt(priv::simd::add(priv::simd::mul(x, x), priv::simd::mul(y, y)));
+			priv::simd::pack nonzero = priv::simd::not_equal(m, zero);
+
+			x = priv::simd::select(nonzero, priv::simd::div(x, m), x);
+			y = priv::simd::select(nonzero, priv::simd::div(y, m), y);
+			priv::simd::store_pairs(v + 2u * i, x, y);
+		}
+
+		#endif
+
+		for (; i < n; ++i)
+		{
+			float m = std::sqrt(v[2u * i] * v[2u * i] + v[2u * i + 1u] * v[2u * i + 1u]);
+
+			if (m != 0.f)
+			{
+				v[2u * i] /= m;
+				v[2u * i + 1u] /= m;
+			}
+		}
+	}
+
+	// Returns the index of the point closest to target, the first one if
+	// several are equally close, or points.size() if there are no points.
+	inline std::size_t nearest(std::span<const Point2f> points, const Point2f& target)
+	{
+		float best;
+		return priv::nearest_in(priv::floats(points), 0u, points.size(), target, best);
+	}
+
+	// Sets out[i] to the index of the point closest to points[i] other than
+	// itself, the first one if several are equally close, or points.size()
+	// if there is only one point. Compares every pair, which suits the few
+	// thousand points that fit the cache.
+	// Throws std::invalid_argument if points and out differ in size.
+	inline void nearest_neighbours(std::span<const Point2f> points, std::span<std::size_t> out)
+	{
+		priv::check_sizes(points, out);
+
+		const float* p = priv::floats(points);
+		std::size_t n = points.size();
+
+		for (std::size_t i = 0u; i < n; ++i)
+		{
+			float before, after;
+			std::size_t below = priv::nearest_in(p, 0u, i, points[i], before);
+			std::size_t above = priv::nearest_in(p, i + 1u, n, points[i], after);
+
+			if (below == i)
+				below = n;
+			if (above == n || (below != n && !(after < before)))
+				above = below;
+
+			out[i] = above;
+		}
+	}
+
+	// Appends the index of every point within radius of center,
+	// in order, to indices. Returns the number of indices appended.
+	inline std::size_t within_radius(std::span<const Point2f> points, const Point2f& center, float radius, std::vector<std::size_t>& indices)
+	{
+		const float* p = priv::floats(points);
+		std::size_t n = points.size();
+		std::size_t count = indices.size();
+		float limit = radius * radius;
+		std::size_t i = 0u;
+
+		#if defined(SFML_VECTORMATH_SIMD)
+
+		priv::simd::pack cx = priv::simd::broadcast(center.x);
+		priv::simd::pack cy = priv::simd::broadcast(center.y);
+		priv::simd::pack r2 = priv::simd::broadcast(limit);
+
+		for (; i + priv::simd::pack_width <= n; i += priv::simd::pack_width)
+		{
+			priv::simd::pack x, y;
+			priv::simd::load_pairs(p + 2u * i, x, y);
+
+			x = priv::simd::sub(x, cx);
+			y = priv::simd::sub(y, cy);
+
+			int inside = priv::simd::bits(priv::simd::less_equal(priv::simd::add(priv::simd::mul(x, x), priv::simd::mul(y, y)), r2));
+
+			for (std::size_t j = i; inside != 0; inside >>= 1, ++j)
+			{
+				if ((inside & 1) != 0)
+					indices.push_back(j);
+			}
+		}
+
+		#endif
+
+		for (; i < n; ++i)
+		{
+			float dx = p[2u * i] - center.x;
+			float dy = p[2u * i + 1u] - center.y;
+
+			if (dx * dx + dy * dy <= limit)
+				indices.push_back(i);
+		}
+
+		return indices.size() - count;
+	}
+}
+
+SFML_VECTORMATH_CONTRACT_RESTORE
+
+#endif // SFML_VECTORMATH_HPP
\ No newline at end of file
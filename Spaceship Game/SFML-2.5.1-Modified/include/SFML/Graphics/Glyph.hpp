@@ -1,5 +1,9 @@
 ////////////////////////////////////////////////////////////
-//
+// 
+// This is a modified version of the SFML 2.5.1 file Glyph.hpp
+// Modified by Justyn Durnford
+// Last modified on 2026-10-17
+// 
 // SFML - Simple and Fast Multimedia Library
 // Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
 //
@@ -46,7 +50,7 @@ public:
     /// \brief Default constructor
     ///
     ////////////////////////////////////////////////////////////
-    Glyph() : advance(0) {}
+    Glyph() : advance(0), bounds(), textureRect() {}
 
     ////////////////////////////////////////////////////////////
     // Member data
@@ -0,0 +1,254 @@
+////////////////////////////////////////////////////////////
+// 
+// This is an added file for this modified version of SFML 2.5.1
+// Modified by Justyn Durnford
+// Last modified on 2026-10-17
+// 
+// SFML - Simple and Fast Multimedia Library
+// Copyright (X) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_RECORDINGTARGET_HPP
+#define SFML_RECORDINGTARGET_HPP
+
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/SoftwareRasterizer.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/SpriteBatch.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace sf
+{
+	// A render target that needs no GPU: it records every clear and draw
+	// made on it into a list of commands that can be inspected afterwards,
+	// and can also render them on the CPU into an image, with a
+	// SoftwareRasterizer.
+	//
+	// It takes draws the way RenderTarget::draw() does, so SpriteBatch::
+	// drawTo() and RenderQueue::flush() can draw on it. A RenderTarget hands
+	// every other Drawable its GPU draw calls directly, so those cannot be
+	// recorded.
+	//
+	// Textures live on the GPU, so to rasterise textured draws it needs a
+	// copy of each texture's pixels, given with setTextureImage(). Draws
+	// with a texture it has no image for are filled as if it were white.
+	// Shaders are recorded but cannot be run; rasterised draws ignore them.
+	class RecordingTarget
+	{
+		public:
+
+		// One recorded clear or draw.
+		struct Command
+		{
+			enum Kind
+			{
+				Clear,
+				Draw
+			};
+
+			Kind kind;
+
+			// The colour a Clear cleared to.
+			Color color;
+
+			// The rest describe a Draw.
+			PrimitiveType type;
+			std::size_t first;
+			std::size_t count;
+			Transform transform;
+			const Texture* texture;
+			const Shader* shader;
+			BlendMode blendMode;
+		};
+
+		private:
+
+		Vector2u size_;
+		View view_;
+		std::vector<Command> commands_;
+		std::vector<Vertex> vertices_;
+		std::unique_ptr<SoftwareRasterizer> rasterizer_;
+
+		public:
+
+		// Creates a width by height target. If rasterize is true, every clear
+		// and draw is also rasterised into an image that capture() returns,
+		// on one thread per hardware thread.
+		RecordingTarget(unsigned int width, unsigned int height, bool rasterize = false)
+			: size_(width, height),
+			  view_(FloatRect(0.f, 0.f, static_cast<float>(width), static_cast<float>(height)))
+		{
+			if (rasterize)
+				rasterizer_ = std::make_unique<SoftwareRasterizer>(width, height);
+		}
+
+		//
+		Vector2u getSize() const
+		{
+			return size_;
+		}
+
+		//
+		void setView(const View& view)
+		{
+			view_ = view;
+
+			if (rasterizer_)
+				rasterizer_->setView(view);
+		}
+
+		//
+		const View& getView() const
+		{
+			return view_;
+		}
+
+		// Gives the pixels of texture, for textured draws to be rasterised
+		// with. image must outlive the target, or be replaced or removed with
+		// a null image first.
+		void setTextureImage(const Texture& texture, const Image* image)
+		{
+			if (rasterizer_)
+				rasterizer_->setTextureImage(texture, image);
+		}
+
+		// Records a clear to color.
+		void clear(const Color& color = Color(0, 0, 0, 255))
+		{
+			Command command = {};
+			command.kind = Command::Clear;
+			command.color = color;
+			command.first = vertices_.size();
+			commands_.push_back(command);
+
+			if (rasterizer_)
+				rasterizer_->clear(color);
+		}
+
+		// Records a draw of count vertices, as RenderTarget::draw() takes them.
+		void draw(const Vertex* vertices, std::size_t count, PrimitiveType type, const RenderStates& states = RenderStates::Default)
+		{
+			if (vertices == nullptr || count == 0u)
+				return;
+
+			Command command = { Command::Draw, Color(), type, vertices_.size(), count,
+				states.transform, states.texture, states.shader, states.blendMode };
+
+			vertices_.insert(vertices_.end(), vertices, vertices + count);
+			commands_.push_back(command);
+
+			if (rasterizer_)
+				rasterizer_->draw(vertices, count, type, states);
+		}
+
+		// Records a draw of array.
+		void draw(const VertexArray& array, const RenderStates& states = RenderStates::Default)
+		{
+			if (array.getVertexCount() > 0u)
+				draw(&array[0], array.getVertexCount(), array.getPrimitiveType(), states);
+		}
+
+		// Records a draw of sprite, as the one quad it is drawn as.
+		// Sprites without a texture are skipped, as Sprite::draw() skips them.
+		void draw(const Sprite& sprite, RenderStates states = RenderStates::Default)
+		{
+			if (sprite.getTexture() == nullptr)
+				return;
+
+			Vertex quad[4];
+			priv::sprite_quad(sprite, quad);
+
+			states.transform *= sprite.getTransform();
+			states.texture = sprite.getTexture();
+			draw(quad, 4u, Quads, states);
+		}
+
+		// Records the draws of batch, one for each run of sprites.
+		void draw(const SpriteBatch& batch, const RenderStates& states = RenderStates::Default)
+		{
+			batch.drawTo(*this, states);
+		}
+
+		// Returns every command recorded since the target was created or reset() was called.
+		const std::vector<Command>& commands() const
+		{
+			return commands_;
+		}
+
+		// Returns the vertices of a recorded draw, as they were passed to draw().
+		const Vertex* vertices(const Command& command) const
+		{
+			return vertices_.data() + command.first;
+		}
+
+		// Returns the number of recorded draws, not counting clears.
+		std::size_t drawCount() const
+		{
+			return static_cast<std::size_t>(std::count_if(commands_.begin(), commands_.end(),
+				[](const Command& command) { return command.kind == Command::Draw; }));
+		}
+
+		// Forgets every recorded command. The rasterised image is kept.
+		void reset()
+		{
+			commands_.clear();
+			vertices_.clear();
+		}
+
+		//
+		bool isRasterizing() const
+		{
+			return rasterizer_ != nullptr;
+		}
+
+		// Rasterises every draw since the last clear, as capture() does,
+		// without copying the image out. Draws are only queued until then,
+		// and a clear drops those still queued.
+		void finish()
+		{
+			if (rasterizer_)
+				rasterizer_->finish();
+		}
+
+		// Returns the rasterised image, or an empty one if the target does not rasterise.
+		Image capture() const
+		{
+			return rasterizer_ ? rasterizer_->capture() : Image();
+		}
+	};
+}
+
+#endif // SFML_RECORDINGTARGET_HPP
\ No newline at end of file
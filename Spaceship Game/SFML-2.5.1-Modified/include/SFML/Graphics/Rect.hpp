@@ -2,7 +2,7 @@
 // 
 // This is a modified version of the SFML 2.5.1 file Rect.hpp
 // Modified by Justyn Durnford
-// Last modified on 2021-05-11
+// Last modified on 2026-10-17
 // 
 // SFML - Simple and Fast Multimedia Library
 // Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
@@ -30,6 +30,7 @@
 #define SFML_RECT_HPP
 
 #include <algorithm>
+#include <type_traits>
 #include <SFML/System/Vector2.hpp>
 
 namespace sf
@@ -48,73 +49,43 @@ namespace sf
         T height;
 
         // \brief Default constructor.
-        // Creates a Rect(0, 0, 0, 0)).
-        Rect()
-        {
-            left = static_cast<T>(0);
-            top = static_cast<T>(0);
-            width = static_cast<T>(0);
-            height = static_cast<T>(0);
-        }
+        // Leaves the members uninitialised so that Rect stays trivial.
+        // Rect() and Rect{} still create a Rect(0, 0, 0, 0).
+        Rect() = default;
 
         // \brief Constructs the Rect from its coordinates and dimensions.
         // \param Left:      Left coordinate of the top-left vertex of the Rect
         // \param Top:       Top coordinate of the top-left vertex of the Rect
         // \param Width:     Width of the Rect
         // \param Height:    Height of the Rect
-        Rect(T Left, T Top, T Width, T Height)
-        {
-            left = Left;
-            top = Top;
-            width = Width;
-            height = Height;
-        }
+        constexpr Rect(T Left, T Top, T Width, T Height)
+            : left(Left), top(Top), width(Width), height(Height) {}
 
         // \brief Constructs the Rect from the Point2 and dimensions.
         // \param Position:  Position of the top-left vertex of the Rect
         // \param Width:     Width of the Rect
         // \param Height:    Height of the Rect
-        Rect(const Point2<T>& Position, T Width, T Height)
-        {
-            left = Position.x;
-            top = Position.y;
-            width = Width;
-            height = Height;
-        }
+        constexpr Rect(const Point2<T>& Position, T Width, T Height)
+            : left(Position.x), top(Position.y), width(Width), height(Height) {}
 
         // \brief Constructs the Rect from the Vector2 and dimensions.
         // \param Position:  Position of the top-left vertex of the Rect
         // \param Width:     Width of the Rect
         // \param Height:    Height of the Rect
-        Rect(const Vector2<T>& Position, T Width, T Height)
-        {
-            left = Position.x;
-            top = Position.y;
-            width = Width;
-            height = Height;
-        }
+        constexpr Rect(const Vector2<T>& Position, T Width, T Height)
+            : left(Position.x), top(Position.y), width(Width), height(Height) {}
 
         // \brief Constructs the Rect from the two Point2s.
         // \param Position:   Position of the top-left vertex of the Rect
         // \param Dimensions: Dimensions of the Rect
-        Rect(const Point2<T>& Position, const Point2<T>& Dimensions)
-        {
-            left = Position.x;
-            top = Position.y;
-            width = Dimensions.x;
-            height = Dimensions.y;
-        }
+        constexpr Rect(const Point2<T>& Position, const Point2<T>& Dimensions)
+            : left(Position.x), top(Position.y), width(Dimensions.x), height(Dimensions.y) {}
 
         // \brief Constructs the Rect from the two Vector2s.
         // \param Position:   Position of the top-left vertex of the Rect
         // \param Dimensions: Dimensions of the Rect
-        Rect(const Vector2<T>& Position, const Vector2<T>& Dimensions)
-        {
-            left = Position.x;
-            top = Position.y;
-            width = Dimensions.x;
-            height = Dimensions.y;
-        }
+        constexpr Rect(const Vector2<T>& Position, const Vector2<T>& Dimensions)
+            : left(Position.x), top(Position.y), width(Dimensions.x), height(Dimensions.y) {}
 
         // \brief Constructs the Rect from another type of Rect.
         //
@@ -125,16 +96,12 @@ namespace sf
         //
         // \param other: Rect to convert
         template <typename U>
-        explicit Rect(const Rect<U>& other)
-        {
-            top = static_cast<T>(other.top);
-            left = static_cast<T>(other.left);
-            width = static_cast<T>(other.width);
-            height = static_cast<T>(other.height);
-        }
+        constexpr explicit Rect(const Rect<U>& other)
+            : left(static_cast<T>(other.left)), top(static_cast<T>(other.top)),
+              width(static_cast<T>(other.width)), height(static_cast<T>(other.height)) {}
 
         // \brief Scales the Rect by a factor of N.
-        void scale(T N)
+        constexpr void scale(T N)
         {
             top *= N;
             left *= N;
@@ -144,42 +111,42 @@ namespace sf
 
         // \brief Returns the area of the Rect.
         // \return width * height
-        T area() const
+        constexpr T area() const
         {
             return width * height;
         }
 
         // \brief Returns the perimeter of the Rect.
         // \return 2 * (width + height)
-        T perimeter() const
+        constexpr T perimeter() const
         {
             return static_cast<T>(2) * (width + height);
         }
 
         // \brief Returns the top-left vertex of the Rect.
         // \return Point2<T>(top, left)
-        Point2<T> topLeft() const
+        constexpr Point2<T> topLeft() const
         {
             return Point2<T>(top, left);
         }
 
         // \brief Returns the top-right vertex of the Rect.
         // \return Point2<T>(top, left + width)
-        Point2<T> topRight() const
+        constexpr Point2<T> topRight() const
         {
             return Point2<T>(top, left + width);
         }
 
         // \brief Returns the bottom-left vertex of the Rect.
         // \return Point2<T>(top + height, left)
-        Point2<T> bottomLeft() const
+        constexpr Point2<T> bottomLeft() const
         {
             return Point2<T>(top + height, left);
         }
 
         // \brief Returns the bottom-right vertex of the Rect.
         // \return Point2<T>(top + height, left + width)
-        Point2<T> bottomRight() const
+        constexpr Point2<T> bottomRight() const
         {
             return Point2<T>(top + height, left + width);
         }
@@ -192,7 +159,7 @@ namespace sf
         // \param X: X coordinate of the point to test
         // \param Y: Y coordinate of the point to test
         // \return True if the point is inside the Rect, False otherwise.
-        bool contains(T X, T Y) const
+        constexpr bool contains(T X, T Y) const
         {
             return (X > left) && (X < left + width) && (Y > top) && (Y < top + height);
         }
@@ -204,7 +171,7 @@ namespace sf
         //
         // \param P: Point to test
         // \return True if the point is inside the Rect, False otherwise.
-        bool contains(const Point2<T>& P) const
+        constexpr bool contains(const Point2<T>& P) const
         {
             return (P.x > left) && (P.x < left + width) && (P.y > top) && (P.y < top + height);
         }
@@ -216,7 +183,7 @@ namespace sf
         //
         // \param P: Point to test
         // \return True if the point is inside the Rect, False otherwise.
-        bool contains(const Vector2<T>& P) const
+        constexpr bool contains(const Vector2<T>& P) const
         {
             return (P.x > left) && (P.x < left + width) && (P.y > top) && (P.y < top + height);
         }
@@ -229,7 +196,7 @@ namespace sf
         // \param X: X coordinate of the point to test
         // \param Y: Y coordinate of the point to test
         // \return True if the point is inside or on the Rect, False otherwise.
-        bool containsInclusive(T X, T Y) const
+        constexpr bool containsInclusive(T X, T Y) const
         {
             return (X >= left) && (X <= left + width) && (Y >= top) && (Y <= top + height);
         }
@@ -241,7 +208,7 @@ namespace sf
         //
         // \param P: Point to test
         // \return True if the point is inside or on the Rect, False otherwise.
-        bool containsInclusive(const Point2<T>& P) const
+        constexpr bool containsInclusive(const Point2<T>& P) const
         {
             return (P.x > left) && (P.x < left + width) && (P.y > top) && (P.y < top + height);
         }
@@ -253,7 +220,7 @@ namespace sf
         //
         // \param P: Point to test
         // \return True if the point is inside or on the Rect, False otherwise.
-        bool containsInclusive(const Vector2<T>& P) const
+        constexpr bool containsInclusive(const Vector2<T>& P) const
         {
             return (P.x > left) && (P.x < left + width) && (P.y > top) && (P.y < top + height);
         }
@@ -268,7 +235,7 @@ namespace sf
         /// \see contains
         ///
         ////////////////////////////////////////////////////////////
-        bool intersects(const Rect<T>& rectangle) const
+        constexpr bool intersects(const Rect<T>& rectangle) const
         {
             Rect<T> intersection;
             return intersects(rectangle, intersection);
@@ -288,7 +255,7 @@ namespace sf
         /// \see contains
         ///
         ////////////////////////////////////////////////////////////
-        bool intersects(const Rect<T>& rectangle, Rect<T>& intersection) const
+        constexpr bool intersects(const Rect<T>& rectangle, Rect<T>& intersection) const
         {
             // Rectangles with negative dimensions are allowed, so we must handle them correctly
 
@@ -333,12 +300,16 @@ namespace sf
     typedef Rect<unsigned int>   UIntRect;
     typedef Rect<float>          FloatRect;
 
+    static_assert(std::is_trivial_v<FloatRect>, "FloatRect must be trivial");
+    static_assert(std::is_standard_layout_v<FloatRect>, "FloatRect must be standard layout");
+    static_assert(sizeof(FloatRect) == 4u * sizeof(float), "FloatRect must be four packed floats");
+
     // \brief Checks for an intersection between two Rects.
     // \param A: First Rect
     // \param B: Second Rect
     // \return True if the Rects overlap, False otherwise
     template <typename T, typename U>
-    bool is_intersection(const Rect<T>& A, const Rect<U>& B)
+    constexpr bool is_intersection(const Rect<T>& A, const Rect<U>& B)
     {
         if ((A.left < B.left) && (A.left + A.width < B.left))
             return false;
@@ -355,15 +326,15 @@ namespace sf
 }
 
 // \brief Overload of binary operator ==
-template <typename T, typename U>
-bool operator == (const sf::Rect<T>& A, const sf::Rect<T>& B)
+template <typename T>
+constexpr bool operator == (const sf::Rect<T>& A, const sf::Rect<T>& B)
 {
     return (A.left == B.left) && (A.width == B.width) && (A.top == B.top) && (A.height == B.height);
 }
 
 // \brief Overload of binary operator !=
-template <typename T, typename U>
-bool operator != (const sf::Rect<T>& A, const sf::Rect<T>& B)
+template <typename T>
+constexpr bool operator != (const sf::Rect<T>& A, const sf::Rect<T>& B)
 {
     return (A.left != B.left) || (A.width != B.width) || (A.top != B.top) || (A.height != B.height);
 }
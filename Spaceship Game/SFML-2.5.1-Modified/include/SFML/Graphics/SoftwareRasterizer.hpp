@@ -0,0 +1,801 @@
+////////////////////////////////////////////////////////////
+// 
+// This is an added file for this modified version of SFML 2.5.1
+// Modified by Justyn Durnford
+// Last modified on 2026-10-17
+// 
+// SFML - Simple and Fast Multimedia Library
+// Copyright (X) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_SOFTWARERASTERIZER_HPP
+#define SFML_SOFTWARERASTERIZER_HPP
+
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <SFML/System/ThreadPool.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <SFML/System/VectorMath.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+SFML_VECTORMATH_CONTRACT_OFF
+
+namespace sf
+{
+	// Renders vertices into an image on the CPU, for rendering where there
+	// is no GPU, such as thumbnails or replays on a server.
+	//
+	// Draws are taken the way RenderTarget::draw() takes them, mapped to
+	// pixels through the current view and queued. finish(), which capture()
+	// calls, then renders everything queued: the target is cut into square
+	// tiles, every primitive is binned into the tiles it overlaps, and the
+	// tiles are rendered in parallel on a ThreadPool. Each tile renders its
+	// primitives in the order they were drawn, so the result is the same
+	// whatever the number of threads.
+	//
+	// Vertices are snapped to 1/256 of a pixel, as GPUs snap them, which
+	// makes the edge functions of triangles exact in double. Triangles are
+	// filled by evaluating them at several pixel centres at once, four with
+	// AVX or two with SSE2, using the same SIMD layer as the batch vector
+	// operations. A pixel centre lying exactly on an edge shared by two
+	// triangles is filled by one of them only, so quads and meshes blend no
+	// pixel twice. Lines are one pixel wide and leave out their last pixel,
+	// and points cover one pixel.
+	//
+	// Colours and texture coordinates are interpolated across primitives.
+	// Textures are sampled from images with the nearest texel, repeated or
+	// clamped as the Texture is, and modulate the vertex colour. The result
+	// is blended in with the draw's BlendMode, its factors and equations
+	// applied per channel as OpenGL applies them. Shaders cannot be run,
+	// and are ignored. Contraction into fused multiply-adds is turned off,
+	// as it is for the batch vector operations, so images do not depend on
+	// the instruction set either.
+	class SoftwareRasterizer
+	{
+		// A vertex mapped to pixel coordinates, snapped to 1/256 of a pixel,
+		// with its colour in [0, 1].
+		struct PixelVertex
+		{
+			double x, y;
+			float r, g, b, a;
+			float u, v;
+		};
+
+		// What a draw's primitives share.
+		struct DrawInfo
+		{
+			const Image* image;
+			bool repeated;
+			BlendMode blendMode;
+			IntRect clip;
+		};
+
+		// A triangle, line or point, as indices into points_.
+		struct Primitive
+		{
+			enum Kind : std::uint32_t
+			{
+				Point,
+				Line,
+				Triangle
+			};
+
+			Kind kind;
+			std::uint32_t draw;
+			std::uint32_t index[3];
+		};
+
+		Vector2u size_;
+		unsigned int tileSize_;
+		unsigned int tilesX_;
+		unsigned int tilesY_;
+		std::unique_ptr<ThreadPool> ownPool_;
+		ThreadPool* pool_;
+		View view_;
+		std::unordered_map<const Texture*, const Image*> textureImages_;
+		std::vector<std::uint8_t> pixels_;
+		std::vector<PixelVertex> points_;
+		std::vector<DrawInfo> draws_;
+		std::vector<Primitive> primitives_;
+
+		// One bin per tile for every slice of primitives_, slice by slice,
+		// so that the slices can be binned in parallel.
+		std::vector<std::vector<std::uint32_t>> bins_;
+
+		// Multiplying is much cheaper than dividing, per pixel.
+		static constexpr float inv255 = 1.f / 255.f;
+
+		// How far from the origin vertices are kept, in pixels. Coordinates
+		// on a 1/256 grid within it, and pixel centres of a target no larger
+		// than it, differ by at most 2^25 steps of the grid, so edge
+		// functions take at most 51 bits and are exact in double.
+		static constexpr double snap_limit = 65536.0;
+
+		// Returns coordinate snapped to 1/256 of a pixel and kept within
+		// snap_limit of the origin. NaN goes to -snap_limit, out of sight.
+		static double snap(float coordinate)
+		{
+			double clamped = coordinate >= -snap_limit ? std::min(static_cast<double>(coordinate), snap_limit) : -snap_limit;
+			return std::round(clamped * 256.0) / 256.0;
+		}
+
+		// Returns the value of factor for one channel of a blend.
+		static float blendFactor(BlendMode::Factor factor, float src, float src_alpha, float dst, float dst_alpha)
+		{
+			switch (factor)
+			{
+				case BlendMode::Zero:             return 0.f;
+				case BlendMode::One:              return 1.f;
+				case BlendMode::SrcColor:         return src;
+				case BlendMode::OneMinusSrcColor: return 1.f - src;
+				case BlendMode::DstColor:         return dst;
+				case BlendMode::OneMinusDstColor: return 1.f - dst;
+				case BlendMode::SrcAlpha:         return src_alpha;
+				case BlendMode::OneMinusSrcAlpha: return 1.f - src_alpha;
+				case BlendMode::DstAlpha:         return dst_alpha;
+				case BlendMode::OneMinusDstAlpha: return 1.f - dst_alpha;
+			}
+
+			return 0.f;
+		}
+
+		// Applies equation to the weighted source and destination.
+		static float blendEquation(BlendMode::Equation equation, float src, float dst)
+		{
+			switch (equation)
+			{
+				case BlendMode::Add:             return src + dst;
+				case BlendMode::Subtract:        return src - dst;
+				case BlendMode::ReverseSubtract: return dst - src;
+			}
+
+			return src + dst;
+		}
+
+		// Samples the texture of info, if any, at (u, v), modulates the colour
+		// (r, g, b, a) with it and blends the result into pixel (x, y).
+		void shade(int x, int y, float r, float g, float b, float a, float u, float v, const DrawInfo& info)
+		{
+			if (info.image != nullptr)
+			{
+				Vector2u size = info.image->getSize();
+
+				if (size.x > 0u && size.y > 0u)
+				{
+					int w = static_cast<int>(size.x);
+					int h = static_cast<int>(size.y);
+					int tx = static_cast<int>(std::clamp(std::floor(u), -16777216.f, 16777216.f));
+					int ty = static_cast<int>(std::clamp(std::floor(v), -16777216.f, 16777216.f));
+
+					if (info.repeated)
+					{
+						tx = ((tx % w) + w) % w;
+						ty = ((ty % h) + h) % h;
+					}
+					else
+					{
+						tx = std::clamp(tx, 0, w - 1);
+						ty = std::clamp(ty, 0, h - 1);
+					}
+
+					const std::uint8_t* texel = info.image->getPixelsPtr() + (static_cast<std::size_t>(ty) * size.x + static_cast<std::size_t>(tx)) * 4u;
+					r *= texel[0] * inv255;
+					g *= texel[1] * inv255;
+					b *= texel[2] * inv255;
+					a *= texel[3] * inv255;
+				}
+			}
+
+			std::uint8_t* pixel = &pixels_[(static_cast<std::size_t>(y) * size_.x + static_cast<std::size_t>(x)) * 4u];
+			const BlendMode& mode = info.blendMode;
+			float src[4] = { r, g, b, a };
+			float dst[4] = { pixel[0] * inv255, pixel[1] * inv255, pixel[2] * inv255, pixel[3] * inv255 };
+
+			for (int c = 0; c < 4; ++c)
+			{
+				BlendMode::Factor src_factor = c < 3 ? mode.colorSrcFactor : mode.alphaSrcFactor;
+				BlendMode::Factor dst_factor = c < 3 ? mode.colorDstFactor : mode.alphaDstFactor;
+				BlendMode::Equation equation = c < 3 ? mode.colorEquation : mode.alphaEquation;
+
+				float s = src[c] * blendFactor(src_factor, src[c], src[3], dst[c], dst[3]);
+				float d = dst[c] * blendFactor(dst_factor, src[c], src[3], dst[c], dst[3]);
+				float result = std::clamp(blendEquation(equation, s, d), 0.f, 1.f);
+
+				pixel[c] = static_cast<std::uint8_t>(result * 255.f + 0.5f);
+			}
+		}
+
+		// Returns true if a pixel centre exactly on the edge from A to B is
+		// covered. Of two triangles sharing an edge, exactly one covers it.
+		static bool ownsEdge(const PixelVertex& A, const PixelVertex& B)
+		{
+			double dx = B.x - A.x;
+			double dy = B.y - A.y;
+			return dy > 0.0 || (dy == 0.0 && dx < 0.0);
+		}
+
+		// Returns the pixels [left, right] x [top, bottom] that the box
+		// [min_x, max_x] x [min_y, max_y] may touch within clip.
+		// Returns false if there are none.
+		static bool pixelBounds(double min_x, double min_y, double max_x, double max_y, const IntRect& clip,
+			int& left, int& top, int& right, int& bottom)
+		{
+			// Clamp while still in double, so that far off coordinates
+			// cannot overflow the conversion to int.
+			double clip_left = static_cast<double>(clip.left);
+			double clip_top = static_cast<double>(clip.top);
+			double clip_right = static_cast<double>(clip.left + clip.width - 1);
+			double clip_bottom = static_cast<double>(clip.top + clip.height - 1);
+
+			if (!(min_x <= clip_right + 1.0 && max_x >= clip_left - 1.0 && min_y <= clip_bottom + 1.0 && max_y >= clip_top - 1.0))
+				return false;
+
+			left = static_cast<int>(std::max(std::floor(min_x), clip_left));
+			top = static_cast<int>(std::max(std::floor(min_y), clip_top));
+			right = static_cast<int>(std::min(std::ceil(max_x), clip_right));
+			bottom = static_cast<int>(std::min(std::ceil(max_y), clip_bottom));
+			return left <= right && top <= bottom;
+		}
+
+		// Returns the pixels of primitive within the clip of its draw.
+		bool primitiveBounds(const Primitive& primitive, int& left, int& top, int& right, int& bottom) const
+		{
+			const PixelVertex& A = points_[primitive.index[0]];
+			const PixelVertex& B = points_[primitive.index[primitive.kind == Primitive::Point ? 0 : 1]];
+			const PixelVertex& C = points_[primitive.index[primitive.kind == Primitive::Triangle ? 2 : 0]];
+
+			return pixelBounds(std::min({ A.x, B.x, C.x }), std::min({ A.y, B.y, C.y }),
+				std::max({ A.x, B.x, C.x }), std::max({ A.y, B.y, C.y }),
+				draws_[primitive.draw].clip, left, top, right, bottom);
+		}
+
+		// Fills the part of triangle ABC within clip.
+		void fillTriangle(PixelVertex A, PixelVertex B, PixelVertex C, const IntRect& clip, const DrawInfo& info)
+		{
+			// Exact, as are the edge functions below, since the vertices are snapped.
+			double area = (B.x - A.x) * (C.y - A.y) - (B.y - A.y) * (C.x - A.x);
+
+			if (area == 0.0)
+				return;
+
+			// Wind every triangle the same way, so that inside is positive.
+			if (area < 0.0)
+			{
+				std::swap(B, C);
+				area = -area;
+			}
+
+			double inv_area = 1.0 / area;
+
+			int left, top, right, bottom;
+
+			if (!pixelBounds(std::min({ A.x, B.x, C.x }), std::min({ A.y, B.y, C.y }),
+				std::max({ A.x, B.x, C.x }), std::max({ A.y, B.y, C.y }), clip, left, top, right, bottom))
+				return;
+
+			// Each weight is the edge function of the opposite edge:
+			// w = (Q.x - P.x) * (py - P.y) - (Q.y - P.y) * (px - P.x).
+			const PixelVertex* from[3] = { &B, &C, &A };
+			const PixelVertex* to[3] = { &C, &A, &B };
+			bool owns[3];
+
+			for (int k = 0; k < 3; ++k)
+				owns[k] = ownsEdge(*from[k], *to[k]);
+
+			for (int y = top; y <= bottom; ++y)
+			{
+				double py = static_cast<double>(y) + 0.5;
+				double row[3];
+				double slope[3];
+
+				for (int k = 0; k < 3; ++k)
+				{
+					row[k] = (to[k]->x - from[k]->x) * (py - from[k]->y);
+					slope[k] = to[k]->y - from[k]->y;
+				}
+
+				int x = left;
+
+				#if defined(SFML_VECTORMATH_SIMD)
+
+				using namespace priv::simd;
+
+				constexpr int width = static_cast<int>(double_pack_width);
+				alignas(32) static constexpr double lane_offsets[4] = { 0.5, 1.5, 2.5, 3.5 };
+				const double_pack offsets = load(lane_offsets);
+				const double_pack zero = broadcast(0.0);
+
+				for (; x <= right; x += width)
+				{
+					double_pack px = add(broadcast(static_cast<double>(x)), offsets);
+					alignas(32) double weights[3][4];
+					int covered = (1 << std::min(width, right - x + 1)) - 1;
+
+					for (int k = 0; k < 3; ++k)
+					{
+						double_pack w = sub(broadcast(row[k]), mul(broadcast(slope[k]), sub(px, broadcast(from[k]->x))));
+						int inside = bits(less_equal(zero, w));
+
+						if (!owns[k])
+							inside &= ~bits(equal(w, zero));
+
+						covered &= inside;
+						store(weights[k], w);
+					}
+
+					for (int lane = 0; covered != 0; ++lane, covered >>= 1)
+					{
+						if ((covered & 1) == 0)
+							continue;
+
+						float wa = static_cast<float>(weights[0][lane] * inv_area);
+						float wb = static_cast<float>(weights[1][lane] * inv_area);
+						float wc = static_cast<float>(weights[2][lane] * inv_area);
+
+						shade(x + lane, y,
+							A.r * wa + B.r * wb + C.r * wc, A.g * wa + B.g * wb + C.g * wc,
+							A.b * wa + B.b * wb + C.b * wc, A.a * wa + B.a * wb + C.a * wc,
+							A.u * wa + B.u * wb + C.u * wc, A.v * wa + B.v * wb + C.v * wc, info);
+					}
+				}
+
+				#endif
+
+				for (; x <= right; ++x)
+				{
+					double px = static_cast<double>(x) + 0.5;
+					double weights[3];
+					bool inside = true;
+
+					for (int k = 0; k < 3; ++k)
+					{
+						weights[k] = row[k] - slope[k] * (px - from[k]->x);
+						inside = inside && (weights[k] > 0.0 || (weights[k] == 0.0 && owns[k]));
+					}
+
+					if (!inside)
+						continue;
+
+					float wa = static_cast<float>(weights[0] * inv_area);
+					float wb = static_cast<float>(weights[1] * inv_area);
+					float wc = static_cast<float>(weights[2] * inv_area);
+
+					shade(x, y,
+						A.r * wa + B.r * wb + C.r * wc, A.g * wa + B.g * wb + C.g * wc,
+						A.b * wa + B.b * wb + C.b * wc, A.a * wa + B.a * wb + C.a * wc,
+						A.u * wa + B.u * wb + C.u * wc, A.v * wa + B.v * wb + C.v * wc, info);
+				}
+			}
+		}
+
+		// Draws the part of the line from A to B within clip, one pixel wide,
+		// without its last pixel, so that the lines of a strip do not draw
+		// their joints twice.
+		void drawLine(const PixelVertex& A, const PixelVertex& B, const IntRect& clip, const DrawInfo& info)
+		{
+			double dx = B.x - A.x;
+			double dy = B.y - A.y;
+			double steps = std::ceil(std::max(std::abs(dx), std::abs(dy)));
+
+			if (!(steps >= 1.0 && steps < 16777216.0))
+				return;
+
+			// Only walk the steps that can land in clip, so that a long line
+			// costs each tile it crosses no more than its part of the line.
+			double first = 0.0;
+			double last = steps - 1.0;
+			double bounds[2][3] = { { A.x, dx, static_cast<double>(clip.left) }, { A.y, dy, static_cast<double>(clip.top) } };
+			double extent[2] = { static_cast<double>(clip.width), static_cast<double>(clip.height) };
+
+			for (int axis = 0; axis < 2; ++axis)
+			{
+				double start = bounds[axis][0];
+				double delta = bounds[axis][1];
+				double low = bounds[axis][2] - 1.0;
+				double high = bounds[axis][2] + extent[axis] + 1.0;
+
+				if (delta == 0.0)
+				{
+					if (start < low || start > high)
+						return;
+
+					continue;
+				}
+
+				double t0 = (low - start) / delta * steps;
+				double t1 = (high - start) / delta * steps;
+				first = std::max(first, std::floor(std::min(t0, t1)));
+				last = std::min(last, std::ceil(std::max(t0, t1)));
+			}
+
+			for (double i = first; i <= last; ++i)
+			{
+				// Multiplying before dividing keeps whole pixel steps exact.
+				float t = static_cast<float>(i / steps);
+				int x = static_cast<int>(std::floor(A.x + dx * i / steps));
+				int y = static_cast<int>(std::floor(A.y + dy * i / steps));
+
+				if (x < clip.left || y < clip.top || x >= clip.left + clip.width || y >= clip.top + clip.height)
+					continue;
+
+				shade(x, y, A.r + (B.r - A.r) * t, A.g + (B.g - A.g) * t, A.b + (B.b - A.b) * t, A.a + (B.a - A.a) * t,
+					A.u + (B.u - A.u) * t, A.v + (B.v - A.v) * t, info);
+			}
+		}
+
+		// Renders primitive into the part of the target within clip.
+		void render(const Primitive& primitive, const IntRect& clip)
+		{
+			const DrawInfo& info = draws_[primitive.draw];
+			IntRect bounds;
+
+			if (!clip.intersects(info.clip, bounds))
+				return;
+
+			const PixelVertex& A = points_[primitive.index[0]];
+
+			switch (primitive.kind)
+			{
+				case Primitive::Point:
+				{
+					int x = static_cast<int>(std::clamp(std::floor(A.x), -1.0, static_cast<double>(size_.x)));
+					int y = static_cast<int>(std::clamp(std::floor(A.y), -1.0, static_cast<double>(size_.y)));
+
+					if (x >= bounds.left && y >= bounds.top && x < bounds.left + bounds.width && y < bounds.top + bounds.height)
+						shade(x, y, A.r, A.g, A.b, A.a, A.u, A.v, info);
+
+					break;
+				}
+
+				case Primitive::Line:
+					drawLine(A, points_[primitive.index[1]], bounds, info);
+					break;
+
+				case Primitive::Triangle:
+					fillTriangle(A, points_[primitive.index[1]], points_[primitive.index[2]], bounds, info);
+					break;
+			}
+		}
+
+		// Returns the viewport of the current view in pixels.
+		IntRect viewport() const
+		{
+			const FloatRect& ratio = view_.getViewport();
+			float width = static_cast<float>(size_.x);
+			float height = static_cast<float>(size_.y);
+
+			return IntRect(static_cast<int>(0.5f + width * ratio.left), static_cast<int>(0.5f + height * ratio.top),
+				static_cast<int>(0.5f + width * ratio.width), static_cast<int>(0.5f + height * ratio.height));
+		}
+
+		// Queues a primitive of the latest draw, made of points a, b and c.
+		void addPrimitive(Primitive::Kind kind, std::size_t a, std::size_t b = 0u, std::size_t c = 0u)
+		{
+			Primitive primitive = { kind, static_cast<std::uint32_t>(draws_.size() - 1u),
+				{ static_cast<std::uint32_t>(a), static_cast<std::uint32_t>(b), static_cast<std::uint32_t>(c) } };
+			primitives_.push_back(primitive);
+		}
+
+		// Maps vertices to pixels through transform and the current view,
+		// and queues them as primitives of type.
+		void queue(const Vertex* vertices, std::size_t count, PrimitiveType type, const Transform& transform,
+			const Image* image, bool repeated, const BlendMode& blend_mode)
+		{
+			if (vertices == nullptr || count == 0u)
+				return;
+
+			IntRect port = viewport();
+			IntRect clip;
+
+			if (!port.intersects(IntRect(0, 0, static_cast<int>(size_.x), static_cast<int>(size_.y)), clip))
+				return;
+
+			draws_.push_back({ image, repeated, blend_mode, clip });
+
+			// Maps positions to normalised device coordinates, then to pixels.
+			Transform combined = view_.getTransform() * transform;
+			const float* m = combined.getMatrix();
+			std::size_t base = points_.size();
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const Vertex& vertex = vertices[i];
+				float nx = m[0] * vertex.position.x + m[4] * vertex.position.y + m[12];
+				float ny = m[1] * vertex.position.x + m[5] * vertex.position.y + m[13];
+
+				points_.push_back({ snap(port.left + (nx + 1.f) * 0.5f * port.width), snap(port.top + (1.f - ny) * 0.5f * port.height),
+					vertex.color.r * inv255, vertex.color.g * inv255, vertex.color.b * inv255, vertex.color.a * inv255,
+					vertex.texCoords.x, vertex.texCoords.y });
+			}
+
+			switch (type)
+			{
+				case Points:
+					for (std::size_t i = 0; i < count; ++i)
+						addPrimitive(Primitive::Point, base + i);
+					break;
+
+				case Lines:
+					for (std::size_t i = 0; i + 1u < count; i += 2u)
+						addPrimitive(Primitive::Line, base + i, base + i + 1u);
+					break;
+
+				case LineStrip:
+					for (std::size_t i = 0; i + 1u < count; ++i)
+						addPrimitive(Primitive::Line, base + i, base + i + 1u);
+					break;
+
+				case Triangles:
+					for (std::size_t i = 0; i + 2u < count; i += 3u)
+						addPrimitive(Primitive::Triangle, base + i, base + i + 1u, base + i + 2u);
+					break;
+
+				case TriangleStrip:
+					for (std::size_t i = 0; i + 2u < count; ++i)
+						addPrimitive(Primitive::Triangle, base + i, base + i + 1u, base + i + 2u);
+					break;
+
+				case TriangleFan:
+					for (std::size_t i = 1u; i + 1u < count; ++i)
+						addPrimitive(Primitive::Triangle, base, base + i, base + i + 1u);
+					break;
+
+				case Quads:
+					for (std::size_t i = 0; i + 3u < count; i += 4u)
+					{
+						addPrimitive(Primitive::Triangle, base + i, base + i + 1u, base + i + 2u);
+						addPrimitive(Primitive::Triangle, base + i, base + i + 2u, base + i + 3u);
+					}
+					break;
+			}
+		}
+
+		// Forgets every queued draw.
+		void discard()
+		{
+			points_.clear();
+			draws_.clear();
+			primitives_.clear();
+		}
+
+		//
+		void create(unsigned int width, unsigned int height, unsigned int tile_size)
+		{
+			size_ = Vector2u(width, height);
+			tileSize_ = std::max(tile_size, 1u);
+			tilesX_ = (width + tileSize_ - 1u) / tileSize_;
+			tilesY_ = (height + tileSize_ - 1u) / tileSize_;
+			view_.reset(FloatRect(0.f, 0.f, static_cast<float>(width), static_cast<float>(height)));
+			pixels_.resize(static_cast<std::size_t>(width) * height * 4u);
+			clear();
+		}
+
+		public:
+
+		// Creates a width by height rasteriser, cleared to opaque black, that
+		// renders on its own ThreadPool of thread_count threads. 0 uses one
+		// thread per hardware thread. Tiles are tile_size pixels square.
+		SoftwareRasterizer(unsigned int width, unsigned int height, std::size_t thread_count = 0u, unsigned int tile_size = 64u)
+			: ownPool_(std::make_unique<ThreadPool>(thread_count)), pool_(ownPool_.get())
+		{
+			create(width, height, tile_size);
+		}
+
+		// Creates a width by height rasteriser, cleared to opaque black, that
+		// renders on pool. pool must outlive the rasteriser.
+		SoftwareRasterizer(unsigned int width, unsigned int height, ThreadPool& pool, unsigned int tile_size = 64u)
+			: pool_(&pool)
+		{
+			create(width, height, tile_size);
+		}
+
+		SoftwareRasterizer(const SoftwareRasterizer& other) = delete;
+		SoftwareRasterizer& operator = (const SoftwareRasterizer& other) = delete;
+
+		//
+		Vector2u getSize() const
+		{
+			return size_;
+		}
+
+		// Sets the view later draws are mapped through.
+		void setView(const View& view)
+		{
+			view_ = view;
+		}
+
+		//
+		const View& getView() const
+		{
+			return view_;
+		}
+
+		// Gives the pixels of texture, for draws that use it to be sampled
+		// from. image must outlive every draw queued with it, or be replaced
+		// or removed with a null image first. Draws with a texture that has
+		// no image are filled as if it were white.
+		void setTextureImage(const Texture& texture, const Image* image)
+		{
+			if (image == nullptr)
+				textureImages_.erase(&texture);
+			else
+				textureImages_[&texture] = image;
+		}
+
+		// Clears the whole target to color, whatever the view.
+		// Draws still queued would be covered, so they are dropped.
+		void clear(const Color& color = Color(0, 0, 0, 255))
+		{
+			discard();
+
+			for (std::size_t i = 0; i < pixels_.size(); i += 4u)
+			{
+				pixels_[i] = color.r;
+				pixels_[i + 1u] = color.g;
+				pixels_[i + 2u] = color.b;
+				pixels_[i + 3u] = color.a;
+			}
+		}
+
+		// Queues a draw of count vertices, as RenderTarget::draw() takes them.
+		void draw(const Vertex* vertices, std::size_t count, PrimitiveType type, const RenderStates& states = RenderStates::Default)
+		{
+			const Image* image = nullptr;
+			bool repeated = false;
+
+			if (states.texture != nullptr)
+			{
+				auto it = textureImages_.find(states.texture);
+
+				if (it != textureImages_.end())
+				{
+					image = it->second;
+					repeated = states.texture->isRepeated();
+				}
+			}
+
+			queue(vertices, count, type, states.transform, image, repeated, states.blendMode);
+		}
+
+		// Queues a draw of array.
+		void draw(const VertexArray& array, const RenderStates& states = RenderStates::Default)
+		{
+			if (array.getVertexCount() > 0u)
+				draw(&array[0], array.getVertexCount(), array.getPrimitiveType(), states);
+		}
+
+		// Queues a draw of count vertices textured with texture, whose texels
+		// texture coordinates address. The texture of states is ignored.
+		// texture must outlive the draw, and is clamped, never repeated.
+		void draw(const Vertex* vertices, std::size_t count, PrimitiveType type, const Image& texture,
+			const RenderStates& states = RenderStates::Default)
+		{
+			queue(vertices, count, type, states.transform, &texture, false, states.blendMode);
+		}
+
+		// Queues a draw of array textured with texture. See above.
+		void draw(const VertexArray& array, const Image& texture, const RenderStates& states = RenderStates::Default)
+		{
+			if (array.getVertexCount() > 0u)
+				draw(&array[0], array.getVertexCount(), array.getPrimitiveType(), texture, states);
+		}
+
+		// Returns the number of primitives queued and not yet rendered.
+		std::size_t pending() const
+		{
+			return primitives_.size();
+		}
+
+		// Returns the number of threads rendering is spread over.
+		std::size_t threadCount() const
+		{
+			return pool_->threadCount();
+		}
+
+		// Renders every queued draw.
+		void finish()
+		{
+			if (primitives_.empty())
+				return;
+
+			std::size_t tile_count = static_cast<std::size_t>(tilesX_) * tilesY_;
+			std::size_t slice_count = std::min(pool_->threadCount(), primitives_.size());
+			std::size_t slice_length = (primitives_.size() + slice_count - 1u) / slice_count;
+
+			if (bins_.size() < slice_count * tile_count)
+				bins_.resize(slice_count * tile_count);
+
+			// Bin each slice of primitives into the tiles they overlap.
+			pool_->run(slice_count, [&](std::size_t slice)
+			{
+				std::vector<std::uint32_t>* bins = &bins_[slice * tile_count];
+				std::size_t first = slice * slice_length;
+				std::size_t last = std::min(first + slice_length, primitives_.size());
+
+				for (std::size_t t = 0; t < tile_count; ++t)
+					bins[t].clear();
+
+				for (std::size_t i = first; i < last; ++i)
+				{
+					int left, top, right, bottom;
+
+					if (!primitiveBounds(primitives_[i], left, top, right, bottom))
+						continue;
+
+					for (int ty = top / static_cast<int>(tileSize_); ty <= bottom / static_cast<int>(tileSize_); ++ty)
+					{
+						for (int tx = left / static_cast<int>(tileSize_); tx <= right / static_cast<int>(tileSize_); ++tx)
+							bins[static_cast<std::size_t>(ty) * tilesX_ + static_cast<std::size_t>(tx)].push_back(static_cast<std::uint32_t>(i));
+					}
+				}
+			});
+
+			// Render the tiles, each walking its bins slice by slice so that
+			// its primitives come in the order they were drawn.
+			pool_->run(tile_count, [&](std::size_t tile)
+			{
+				int tile_x = static_cast<int>(tile % tilesX_) * static_cast<int>(tileSize_);
+				int tile_y = static_cast<int>(tile / tilesX_) * static_cast<int>(tileSize_);
+				IntRect clip(tile_x, tile_y,
+					std::min(static_cast<int>(tileSize_), static_cast<int>(size_.x) - tile_x),
+					std::min(static_cast<int>(tileSize_), static_cast<int>(size_.y) - tile_y));
+
+				for (std::size_t slice = 0; slice < slice_count; ++slice)
+				{
+					for (std::uint32_t i : bins_[slice * tile_count + tile])
+						render(primitives_[i], clip);
+				}
+			});
+
+			discard();
+		}
+
+		// Renders every queued draw and returns the result.
+		Image capture()
+		{
+			finish();
+
+			Image image;
+			image.create(size_.x, size_.y, pixels_.data());
+			return image;
+		}
+	};
+}
+
+SFML_VECTORMATH_CONTRACT_RESTORE
+
+#endif // SFML_SOFTWARERASTERIZER_HPP
\ No newline at end of file
@@ -0,0 +1,467 @@
+////////////////////////////////////////////////////////////
+// 
+// This is an added file for this modified version of SFML 2.5.1
+// Modified by Justyn Durnford
+// Last modified on 2026-10-17
+// 
+// SFML - Simple and Fast Multimedia Library
+// Copyright (X) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_TEXTUREATLAS_HPP
+#define SFML_TEXTUREATLAS_HPP
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace sf
+{
+	namespace priv
+	{
+		// Packs rectangles into a bin with the MaxRects algorithm: it keeps
+		// every maximal free rectangle, which may overlap, and puts each new
+		// rectangle into the free one it leaves the least short side of.
+		class MaxRectsPacker
+		{
+			std::vector<IntRect> free_;
+
+			// Returns true if A lies entirely within B.
+			static bool contains(const IntRect& A, const IntRect& B)
+			{
+				return A.left >= B.left && A.top >= B.top
+				    && A.left + A.width <= B.left + B.width && A.top + A.height <= B.top + B.height;
+			}
+
+			// Replaces every free rectangle that overlaps used with the
+			// parts of it on each side of used.
+			void split(const IntRect& used)
+			{
+				std::size_t n = free_.size();
+
+				for (std::size_t i = 0; i < n;)
+				{
+					IntRect rect = free_[i];
+
+					if (!rect.intersects(used))
+					{
+						++i;
+						continue;
+					}
+
+					if (used.left > rect.left)
+						free_.push_back(IntRect(rect.left, rect.top, used.left - rect.left, rect.height));
+					if (used.left + used.width < rect.left + rect.width)
+						free_.push_back(IntRect(used.left + used.width, rect.top, rect.left + rect.width - used.left - used.width, rect.height));
+					if (used.top > rect.top)
+						free_.push_back(IntRect(rect.left, rect.top, rect.width, used.top - rect.top));
+					if (used.top + used.height < rect.top + rect.height)
+						free_.push_back(IntRect(rect.left, used.top + used.height, rect.width, rect.top + rect.height - used.top - used.height));
+
+					free_[i] = free_.back();
+					free_.pop_back();
+
+					// The rectangle moved into i was either unchecked, or is new.
+					if (free_.size() < n)
+						--n;
+				}
+
+				prune();
+			}
+
+			// Removes every free rectangle that lies within another.
+			void prune()
+			{
+				for (std::size_t i = 0; i < free_.size(); ++i)
+				{
+					for (std::size_t j = i + 1u; j < free_.size();)
+					{
+						if (contains(free_[j], free_[i]))
+						{
+							free_.erase(free_.begin() + j);
+						}
+						else if (contains(free_[i], free_[j]))
+						{
+							free_.erase(free_.begin() + i);
+							j = i + 1u;
+
+							if (i == free_.size())
+								break;
+						}
+						else
+							++j;
+					}
+				}
+			}
+
+			public:
+
+			// 
+			MaxRectsPacker(int width, int height)
+				: free_(1u, IntRect(0, 0, width, height)) {}
+
+			// Finds room for a width by height rectangle, marks it as used and
+			// writes where it went to placed. Returns false if there is no room.
+			bool insert(int width, int height, IntRect& placed)
+			{
+				int best_short = std::numeric_limits<int>::max();
+				int best_long = std::numeric_limits<int>::max();
+				std::size_t best = free_.size();
+
+				for (std::size_t i = 0; i < free_.size(); ++i)
+				{
+					const IntRect& rect = free_[i];
+
+					if (rect.width < width || rect.height < height)
+						continue;
+
+					int leftover_x = rect.width - width;
+					int leftover_y = rect.height - height;
+					int short_side = std::min(leftover_x, leftover_y);
+					int long_side = std::max(leftover_x, leftover_y);
+
+					if (short_side < best_short || (short_side == best_short && long_side < best_long))
+					{
+						best_short = short_side;
+						best_long = long_side;
+						best = i;
+					}
+				}
+
+				if (best == free_.size())
+					return false;
+
+				placed = IntRect(free_[best].left, free_[best].top, width, height);
+				split(placed);
+				return true;
+			}
+		};
+	}
+
+	// Packs many small images into one large one, so that sprites cut from
+	// them can share one Texture, and be drawn without switching textures.
+	//
+	// Images are added with a name, and get a handle that stays the same
+	// however they are packed. After build(), rect() gives the part of the
+	// atlas each image ended up in, to pass to Sprite::setTextureRect().
+	//
+	// Every image is surrounded by a bleed of its own edge pixels repeated
+	// outwards, so that smoothed or slightly misaligned sampling at its
+	// edges still reads its own colours, and then by transparent padding.
+	//
+	// A built atlas can be saved as an image and an index file, and loaded
+	// again without packing anything, for a faster startup.
+	class TextureAtlas
+	{
+		public:
+
+		// Returned in place of a handle when there is none.
+		static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+		private:
+
+		struct Entry
+		{
+			std::string name;
+			Image image;
+			IntRect rect;
+		};
+
+		std::vector<Entry> entries_;
+		std::unordered_map<std::string, std::size_t> handles_;
+		Image image_;
+		unsigned int padding_;
+		unsigned int bleed_;
+
+		// Repeats the edge pixels of rect of image_ bleed_ pixels outwards.
+		void extrude(const IntRect& rect)
+		{
+			int b = static_cast<int>(bleed_);
+			int right = rect.left + rect.width - 1;
+			int bottom = rect.top + rect.height - 1;
+
+			for (int y = rect.top - b; y <= bottom + b; ++y)
+			{
+				int source_y = std::clamp(y, rect.top, bottom);
+
+				for (int x = rect.left - b; x <= right + b; ++x)
+				{
+					if (x >= rect.left && x <= right && y >= rect.top && y <= bottom)
+					{
+						// Skip the inside of the row.
+						x = right;
+						continue;
+					}
+
+					int source_x = std::clamp(x, rect.left, right);
+					image_.setPixel(static_cast<unsigned int>(x), static_cast<unsigned int>(y),
+						image_.getPixel(static_cast<unsigned int>(source_x), static_cast<unsigned int>(source_y)));
+				}
+			}
+		}
+
+		// Packs every entry into a width by height atlas.
+		// Returns false, and leaves the rects as they were, if they do not fit.
+		bool pack(unsigned int width, unsigned int height, const std::vector<std::size_t>& order)
+		{
+			// The padding after the last column and row may hang off the edge.
+			int border = static_cast<int>(2u * bleed_ + padding_);
+			priv::MaxRectsPacker packer(static_cast<int>(width + padding_), static_cast<int>(height + padding_));
+			std::vector<IntRect> rects(entries_.size());
+
+			for (std::size_t i : order)
+			{
+				Vector2u size = entries_[i].image.getSize();
+				IntRect cell;
+
+				if (!packer.insert(static_cast<int>(size.x) + border, static_cast<int>(size.y) + border, cell))
+					return false;
+
+				rects[i] = IntRect(cell.left + static_cast<int>(bleed_), cell.top + static_cast<int>(bleed_),
+					static_cast<int>(size.x), static_cast<int>(size.y));
+			}
+
+			for (std::size_t i = 0; i < entries_.size(); ++i)
+				entries_[i].rect = rects[i];
+
+			return true;
+		}
+
+		public:
+
+		// 
+		TextureAtlas(unsigned int padding = 2u, unsigned int bleed = 1u)
+			: padding_(padding), bleed_(bleed) {}
+
+		// Adds image under name and returns its handle.
+		// Returns npos if name is already taken.
+		std::size_t add(const std::string& name, const Image& image)
+		{
+			if (handles_.count(name) != 0u)
+				return npos;
+
+			std::size_t handle = entries_.size();
+			entries_.push_back({ name, image, IntRect() });
+			handles_.emplace(name, handle);
+			return handle;
+		}
+
+		// Adds the image in filename under its filename and returns its handle.
+		// Returns npos if the file cannot be loaded or is already added.
+		std::size_t addFromFile(const std::string& filename)
+		{
+			Image image;
+
+			if (!image.loadFromFile(filename))
+				return npos;
+
+			return add(filename, image);
+		}
+
+		// Packs every image into the smallest square or 2:1 atlas, with
+		// sides a power of two, that they fit into, and draws them into it.
+		// Returns false, and leaves the atlas as it was, if they do not fit
+		// into max_size by max_size.
+		//
+		// Images loaded from a prebaked atlas are cut out of it first, so
+		// more images can be added to a loaded atlas and built again.
+		bool build(unsigned int max_size = 4096u)
+		{
+			for (Entry& entry : entries_)
+			{
+				if (entry.image.getSize().x == 0u && entry.rect.width > 0)
+				{
+					entry.image.create(static_cast<unsigned int>(entry.rect.width), static_cast<unsigned int>(entry.rect.height));
+					entry.image.copy(image_, 0u, 0u, entry.rect);
+				}
+			}
+
+			// Largest first, which leaves the small images to fill the gaps.
+			std::vector<std::size_t> order(entries_.size());
+			std::iota(order.begin(), order.end(), std::size_t(0));
+			std::stable_sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b)
+			{
+				Vector2u A = entries_[a].image.getSize();
+				Vector2u B = entries_[b].image.getSize();
+				return std::max(A.x, A.y) > std::max(B.x, B.y);
+			});
+
+			unsigned long long area = 0u;
+
+			for (const Entry& entry : entries_)
+			{
+				Vector2u size = entry.image.getSize();
+				area += static_cast<unsigned long long>(size.x + 2u * bleed_ + padding_) * (size.y + 2u * bleed_ + padding_);
+			}
+
+			// Sizes smaller than the total area cannot fit, so they are
+			// skipped without packing, but every size is checked against
+			// max_size before it is tried.
+			unsigned long long width = 1u;
+			unsigned long long height = 1u;
+
+			while (true)
+			{
+				if (width > max_size || height > max_size)
+					return false;
+
+				if (width * height >= area && pack(static_cast<unsigned int>(width), static_cast<unsigned int>(height), order))
+					break;
+
+				if (width == height)
+					width *= 2u;
+				else
+					height *= 2u;
+			}
+
+			image_.create(static_cast<unsigned int>(width), static_cast<unsigned int>(height), Color::Transparent);
+
+			for (const Entry& entry : entries_)
+			{
+				image_.copy(entry.image, static_cast<unsigned int>(entry.rect.left), static_cast<unsigned int>(entry.rect.top));
+
+				if (bleed_ > 0u && entry.rect.width > 0 && entry.rect.height > 0)
+					extrude(entry.rect);
+			}
+
+			return true;
+		}
+
+		// Returns the handle of the image added under name, or npos if there is none.
+		std::size_t find(const std::string& name) const
+		{
+			auto it = handles_.find(name);
+			return it == handles_.end() ? npos : it->second;
+		}
+
+		// Returns the part of the atlas the image was packed into.
+		// Only meaningful after build() or loadFromFile().
+		const IntRect& rect(std::size_t handle) const
+		{
+			return entries_[handle].rect;
+		}
+
+		// 
+		const std::string& name(std::size_t handle) const
+		{
+			return entries_[handle].name;
+		}
+
+		// Returns the number of images in the atlas.
+		std::size_t size() const
+		{
+			return entries_.size();
+		}
+
+		// Returns the atlas, to load into a Texture.
+		const Image& image() const
+		{
+			return image_;
+		}
+
+		// Saves the atlas to image_file, in any format Image::saveToFile()
+		// supports, and the name and rect of every image to index_file.
+		bool saveToFile(const std::string& image_file, const std::string& index_file) const
+		{
+			if (!image_.saveToFile(image_file))
+				return false;
+
+			std::ofstream index(index_file, std::ios::trunc);
+			Vector2u size = image_.getSize();
+
+			index << "SFAT 1" << '\n' << size.x << ' ' << size.y << ' ' << entries_.size() << '\n';
+
+			for (const Entry& entry : entries_)
+			{
+				index << entry.rect.left << ' ' << entry.rect.top << ' ' << entry.rect.width << ' '
+				      << entry.rect.height << ' ' << entry.name << '\n';
+			}
+
+			return static_cast<bool>(index);
+		}
+
+		// Replaces the atlas with one written by saveToFile(). Handles are
+		// given out in the order the images were added to the saved atlas.
+		// Returns false, and leaves the atlas as it was, if either file
+		// cannot be read or they do not match.
+		bool loadFromFile(const std::string& image_file, const std::string& index_file)
+		{
+			std::ifstream index(index_file);
+			std::string magic;
+			int version = 0;
+			unsigned int width = 0u;
+			unsigned int height = 0u;
+			std::size_t count = 0u;
+
+			if (!(index >> magic >> version >> width >> height >> count) || magic != "SFAT" || version != 1)
+				return false;
+
+			// count comes from the file, so entries grow as they are read
+			// rather than being allocated up front.
+			std::vector<Entry> entries;
+			std::unordered_map<std::string, std::size_t> handles;
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				Entry entry;
+
+				if (!(index >> entry.rect.left >> entry.rect.top >> entry.rect.width >> entry.rect.height))
+					return false;
+
+				// The name is the rest of the line, after one space.
+				index.get();
+				std::getline(index, entry.name);
+
+				// Add in 64 bits, so that a huge rect cannot wrap around into the image.
+				if (entry.rect.left < 0 || entry.rect.top < 0 || entry.rect.width < 0 || entry.rect.height < 0
+					|| static_cast<std::int64_t>(entry.rect.left) + entry.rect.width > width
+					|| static_cast<std::int64_t>(entry.rect.top) + entry.rect.height > height
+					|| !handles.emplace(entry.name, i).second)
+					return false;
+
+				entries.push_back(std::move(entry));
+			}
+
+			Image image;
+
+			if (!image.loadFromFile(image_file) || image.getSize().x != width || image.getSize().y != height)
+				return false;
+
+			entries_ = std::move(entries);
+			handles_ = std::move(handles);
+			image_ = std::move(image);
+			return true;
+		}
+	};
+}
+
+#endif // SFML_TEXTUREATLAS_HPP
\ No newline at end of file
@@ -0,0 +1,564 @@
+////////////////////////////////////////////////////////////
+// 
+// This is an added file for this modified version of SFML 2.5.1
+// Modified by Justyn Durnford
+// Last modified on 2026-10-16
+// 
+// SFML - Simple and Fast Multimedia Library
+// Copyright (X) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_DYNAMICMATRIX_HPP
+#define SFML_DYNAMICMATRIX_HPP
+
+#include <SFML/System/Arithmetic.hpp>
+#include <SFML/System/Matrix.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace sf
+{
+	namespace priv
+	{
+		// Allocates on Alignment byte boundaries, so that every DynamicMatrix
+		// starts on a cache line and suits aligned SIMD loads.
+		template <typename T, std::size_t Alignment = 64u> struct AlignedAllocator
+		{
+			using value_type = T;
+
+			template <typename U> struct rebind
+			{
+				using other = AlignedAllocator<U, Alignment>;
+			};
+
+			AlignedAllocator() = default;
+
+			template <typename U>
+			AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+
+			T* allocate(std::size_t n)
+			{
+				return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+			}
+
+			void deallocate(T* p, std::size_t)
+			{
+				::operator delete(p, std::align_val_t(Alignment));
+			}
+
+			template <typename U>
+			bool operator == (const AlignedAllocator<U, Alignment>&) const
+			{
+				return true;
+			}
+		};
+
+		// Returns the number of threads to use for work of the given size:
+		// one for small work, where starting threads would cost more than it saves.
+		inline std::size_t thread_count_for(std::size_t requested, std::size_t rows, std::size_t work)
+		{
+			if (work < 64u * 64u * 64u)
+				return 1u;
+
+			if (requested == 0u)
+				requested = std::max(std::thread::hardware_concurrency(), 1u);
+
+			return std::max<std::size_t>(std::min(requested, rows), 1u);
+		}
+
+		// Calls function(first, last) over [0, count) split into thread_count
+		// bands, each on its own thread, and waits for all of them.
+		template <typename Function>
+		void parallel_bands(std::size_t count, std::size_t thread_count, Function function)
+		{
+			if (thread_count <= 1u)
+			{
+				function(std::size_t(0u), count);
+				return;
+			}
+
+			std::vector<std::thread> threads;
+			threads.reserve(thread_count - 1u);
+
+			std::size_t band = (count + thread_count - 1u) / thread_count;
+
+			for (std::size_t first(band); first < count; first += band)
+				threads.emplace_back(function, first, std::min(first + band, count));
+
+			function(std::size_t(0u), std::min(band, count));
+
+			for (std::thread& thread : threads)
+				thread.join();
+		}
+	}
+
+	// A dense Matrix whose size is chosen at runtime. The elements live in
+	// one contiguous heap block, stored row after row, aligned to 64 bytes.
+	// Like Matrix<T, X, Y>, sizes are given columns first and elements are
+	// indexed (x, y), x being the column and y the row.
+	template <arithmetic T> class DynamicMatrix
+	{
+		std::size_t cols_;
+		std::size_t rows_;
+		std::vector<T, priv::AlignedAllocator<T>> data_;
+
+		//
+		inline void checkBounds(std::size_t x, std::size_t y) const
+		{
+			if (y >= rows_)
+				throw std::out_of_range("Invalid row index");
+			if (x >= cols_)
+				throw std::out_of_range("Invalid column index");
+		}
+
+		public:
+
+		using value_type = T;
+		using size_type = std::size_t;
+		using reference = T&;
+		using const_reference = const T&;
+
+		// Creates an empty DynamicMatrix.
+		DynamicMatrix()
+			: cols_(0u), rows_(0u) {}
+
+		// Creates a DynamicMatrix of cols columns and rows rows, all set to value.
+		DynamicMatrix(std::size_t cols, std::size_t rows, const T& value = static_cast<T>(0))
+			: cols_(cols), rows_(rows), data_(cols * rows, value) {}
+
+		// Copies a fixed size Matrix.
+		template <std::size_t X, std::size_t Y>
+		explicit DynamicMatrix(const Matrix<T, X, Y>& M)
+			: cols_(X), rows_(Y), data_(M.data(), M.data() + X * Y) {}
+
+		//
+		DynamicMatrix(const DynamicMatrix& other) = default;
+
+		//
+		DynamicMatrix(DynamicMatrix&& other) noexcept
+			: cols_(other.cols_), rows_(other.rows_), data_(std::move(other.data_))
+		{
+			other.cols_ = 0u;
+			other.rows_ = 0u;
+		}
+
+		//
+		DynamicMatrix& operator = (const DynamicMatrix& other) = default;
+
+		//
+		DynamicMatrix& operator = (DynamicMatrix&& other) noexcept
+		{
+			cols_ = other.cols_;
+			rows_ = other.rows_;
+			data_ = std::move(other.data_);
+			other.cols_ = 0u;
+			other.rows_ = 0u;
+
+			return *this;
+		}
+
+		//
+		~DynamicMatrix() = default;
+
+		// Returns the square DynamicMatrix with ones on the diagonal and zeros elsewhere.
+		static DynamicMatrix identity(std::size_t size)
+		{
+			DynamicMatrix M(size, size);
+
+			for (std::size_t i(0u); i < size; ++i)
+				M(i, i) = static_cast<T>(1);
+
+			return M;
+		}
+
+		//
+		std::size_t rowCount() const
+		{
+			return rows_;
+		}
+
+		//
+		std::size_t colCount() const
+		{
+			return cols_;
+		}
+
+		// Returns the number of elements.
+		std::size_t size() const
+		{
+			return data_.size();
+		}
+
+		// Changes the size. Every element is set to value.
+		void resize(std::size_t cols, std::size_t rows, const T& value = static_cast<T>(0))
+		{
+			cols_ = cols;
+			rows_ = rows;
+			data_.assign(cols * rows, value);
+		}
+
+		//
+		void fill(const T& value)
+		{
+			std::fill(data_.begin(), data_.end(), value);
+		}
+
+		// Returns a pointer to the elements, stored row after row.
+		T* data()
+		{
+			return data_.data();
+		}
+
+		// Returns a pointer to the elements, stored row after row.
+		const T* data() const
+		{
+			return data_.data();
+		}
+
+		// Returns a pointer to the first element of row y.
+		T* row(std::size_t y)
+		{
+			return data_.data() + y * cols_;
+		}
+
+		// Returns a pointer to the first element of row y.
+		const T* row(std::size_t y) const
+		{
+			return data_.data() + y * cols_;
+		}
+
+		//
+		T& at(std::size_t x, std::size_t y)
+		{
+			checkBounds(x, y);
+			return data_[y * cols_ + x];
+		}
+
+		//
+		const T& at(std::size_t x, std::size_t y) const
+		{
+			checkBounds(x, y);
+			return data_[y * cols_ + x];
+		}
+
+		//
+		T& operator () (std::size_t x, std::size_t y)
+		{
+			return data_[y * cols_ + x];
+		}
+
+		//
+		const T& operator () (std::size_t x, std::size_t y) const
+		{
+			return data_[y * cols_ + x];
+		}
+
+		// Throws std::invalid_argument if the sizes differ.
+		DynamicMatrix& operator += (const DynamicMatrix& other)
+		{
+			if (other.cols_ != cols_ || other.rows_ != rows_)
+				throw std::invalid_argument("Matrix sizes differ");
+
+			for (std::size_t i(0u); i < data_.size(); ++i)
+				data_[i] += other.data_[i];
+
+			return *this;
+		}
+
+		// Throws std::invalid_argument if the sizes differ.
+		DynamicMatrix& operator -= (const DynamicMatrix& other)
+		{
+			if (other.cols_ != cols_ || other.rows_ != rows_)
+				throw std::invalid_argument("Matrix sizes differ");
+
+			for (std::size_t i(0u); i < data_.size(); ++i)
+				data_[i] -= other.data_[i];
+
+			return *this;
+		}
+
+		//
+		template <arithmetic U>
+		DynamicMatrix& operator *= (U scalar)
+		{
+			for (T& value : data_)
+				value *= scalar;
+
+			return *this;
+		}
+
+		//
+		template <arithmetic U>
+		DynamicMatrix& operator /= (U scalar)
+		{
+			for (T& value : data_)
+				value /= scalar;
+
+			return *this;
+		}
+	};
+
+	// Sets C to A * B. A has K columns and M rows, B has N columns and K rows.
+	// C is resized to N columns and M rows, and must not be A or B.
+	//
+	// The rows of C are split into bands, one per thread. Within a band,
+	// B is walked in blocks that stay in cache while every row of the band
+	// uses them, and the innermost loop runs along contiguous rows of B and C
+	// so that the compiler can vectorise it.
+	//
+	// thread_count 0 means one thread per hardware thread. Small products
+	// always run on the calling thread.
+	// Throws std::invalid_argument if the sizes do not match.
+	template <arithmetic T>
+	void multiply(const DynamicMatrix<T>& A, const DynamicMatrix<T>& B, DynamicMatrix<T>& C, std::size_t thread_count = 0u)
+	{
+		if (A.colCount() != B.rowCount())
+			throw std::invalid_argument("Matrix sizes do not match");
+		if (&C == &A || &C == &B)
+			throw std::invalid_argument("Matrix product cannot be written to an operand");
+
+		const std::size_t M = A.rowCount();
+		const std::size_t K = A.colCount();
+		const std::size_t N = B.colCount();
+
+		// A block of B is block_k rows of block_n elements: 64 KiB of floats.
+		const std::size_t block_k = 128u;
+		const std::size_t block_n = 128u;
+
+		C.resize(N, M);
+		thread_count = priv::thread_count_for(thread_count, M, M * N * K);
+
+		priv::parallel_bands(M, thread_count, [&](std::size_t first, std::size_t last)
+		{
+			for (std::size_t jj(0u); jj < N; jj += block_n)
+			{
+				std::size_t j_end = std::min(jj + block_n, N);
+
+				for (std::size_t kk(0u); kk < K; kk += block_k)
+				{
+					std::size_t k_end = std::min(kk + block_k, K);
+
+					for (std::size_t i(first); i < last; ++i)
+					{
+						const T* a = A.row(i);
+						T* c = C.row(i);
+
+						for (std::size_t k(kk); k < k_end; ++k)
+						{
+							const T a_ik = a[k];
+							const T* b = B.row(k);
+
+							for (std::size_t j(jj); j < j_end; ++j)
+								c[j] += a_ik * b[j];
+						}
+					}
+				}
+			}
+		});
+	}
+
+	// Returns A * B. See multiply().
+	template <arithmetic T>
+	DynamicMatrix<T> operator * (const DynamicMatrix<T>& A, const DynamicMatrix<T>& B)
+	{
+		DynamicMatrix<T> C;
+		multiply(A, B, C);
+
+		return C;
+	}
+
+	// Throws std::invalid_argument if the sizes differ.
+	template <arithmetic T>
+	DynamicMatrix<T> operator + (const DynamicMatrix<T>& A, const DynamicMatrix<T>& B)
+	{
+		DynamicMatrix<T> C(A);
+		C += B;
+
+		return C;
+	}
+
+	// Throws std::invalid_argument if the sizes differ.
+	template <arithmetic T>
+	DynamicMatrix<T> operator - (const DynamicMatrix<T>& A, const DynamicMatrix<T>& B)
+	{
+		DynamicMatrix<T> C(A);
+		C -= B;
+
+		return C;
+	}
+
+	//
+	template <arithmetic T, arithmetic U>
+	DynamicMatrix<T> operator * (const DynamicMatrix<T>& A, U scalar)
+	{
+		DynamicMatrix<T> C(A);
+		C *= scalar;
+
+		return C;
+	}
+
+	//
+	template <arithmetic T, arithmetic U>
+	DynamicMatrix<T> operator / (const DynamicMatrix<T>& A, U scalar)
+	{
+		DynamicMatrix<T> C(A);
+		C /= scalar;
+
+		return C;
+	}
+
+	// Returns the DynamicMatrix with the rows and columns of M swapped.
+	// Copies in square tiles, so that both the reads and the writes
+	// stay within a few cache lines at a time.
+	template <arithmetic T>
+	DynamicMatrix<T> transpose(const DynamicMatrix<T>& M, std::size_t thread_count = 0u)
+	{
+		const std::size_t tile = 32u;
+		const std::size_t rows = M.rowCount();
+		const std::size_t cols = M.colCount();
+
+		DynamicMatrix<T> R(rows, cols);
+		thread_count = priv::thread_count_for(thread_count, (rows + tile - 1u) / tile, rows * cols);
+
+		// Each thread takes a band of tile rows of M, which are tile columns of R.
+		priv::parallel_bands((rows + tile - 1u) / tile, thread_count, [&](std::size_t first, std::size_t last)
+		{
+			for (std::size_t yy(first * tile); yy < std::min(last * tile, rows); yy += tile)
+			{
+				std::size_t y_end = std::min(yy + tile, rows);
+
+				for (std::size_t xx(0u); xx < cols; xx += tile)
+				{
+					std::size_t x_end = std::min(xx + tile, cols);
+
+					for (std::size_t y(yy); y < y_end; ++y)
+					{
+						for (std::size_t x(xx); x < x_end; ++x)
+							R(y, x) = M(x, y);
+					}
+				}
+			}
+		});
+
+		return R;
+	}
+
+	// Returns the sum of every element.
+	// Each thread sums its own band of rows, and the bands are added at the end.
+	template <arithmetic T>
+	T sum(const DynamicMatrix<T>& M, std::size_t thread_count = 0u)
+	{
+		const std::size_t rows = M.rowCount();
+		const std::size_t cols = M.colCount();
+
+		thread_count = priv::thread_count_for(thread_count, rows, rows * cols);
+		std::vector<T> partial(thread_count, static_cast<T>(0));
+		std::size_t band = std::max<std::size_t>((rows + thread_count - 1u) / thread_count, 1u);
+
+		priv::parallel_bands(rows, thread_count, [&](std::size_t first, std::size_t last)
+		{
+			T total = static_cast<T>(0);
+
+			for (std::size_t y(first); y < last; ++y)
+			{
+				const T* row = M.row(y);
+
+				for (std::size_t x(0u); x < cols; ++x)
+					total += row[x];
+			}
+
+			partial[first / band] = total;
+		});
+
+		T total = static_cast<T>(0);
+
+		for (const T& value : partial)
+			total += value;
+
+		return total;
+	}
+
+	// Returns the smallest element. Throws std::out_of_range if M is empty.
+	template <arithmetic T>
+	T min_element(const DynamicMatrix<T>& M)
+	{
+		if (M.size() == 0u)
+			throw std::out_of_range("Matrix is empty");
+
+		return *std::min_element(M.data(), M.data() + M.size());
+	}
+
+	// Returns the largest element. Throws std::out_of_range if M is empty.
+	template <arithmetic T>
+	T max_element(const DynamicMatrix<T>& M)
+	{
+		if (M.size() == 0u)
+			throw std::out_of_range("Matrix is empty");
+
+		return *std::max_element(M.data(), M.data() + M.size());
+	}
+
+	// Returns a column holding the sum of each row.
+	template <arithmetic T>
+	DynamicMatrix<T> row_sums(const DynamicMatrix<T>& M)
+	{
+		DynamicMatrix<T> R(1u, M.rowCount());
+
+		for (std::size_t y(0u); y < M.rowCount(); ++y)
+		{
+			const T* row = M.row(y);
+			T total = static_cast<T>(0);
+
+			for (std::size_t x(0u); x < M.colCount(); ++x)
+				total += row[x];
+
+			R(0, y) = total;
+		}
+
+		return R;
+	}
+
+	// Returns a row holding the sum of each column.
+	template <arithmetic T>
+	DynamicMatrix<T> col_sums(const DynamicMatrix<T>& M)
+	{
+		DynamicMatrix<T> R(M.colCount(), 1u);
+		T* total = R.row(0);
+
+		// Walk whole rows, adding each one into the totals, to stay contiguous.
+		for (std::size_t y(0u); y < M.rowCount(); ++y)
+		{
+			const T* row = M.row(y);
+
+			for (std::size_t x(0u); x < M.colCount(); ++x)
+				total[x] += row[x];
+		}
+
+		return R;
+	}
+}
+
+#endif // SFML_DYNAMICMATRIX_HPP
\ No newline at end of file
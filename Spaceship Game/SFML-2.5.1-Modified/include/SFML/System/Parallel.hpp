@@ -0,0 +1,251 @@
+////////////////////////////////////////////////////////////
+// 
+// This is an added file for this modified version of SFML 2.5.1
+// Modified by Justyn Durnford
+// Last modified on 2026-10-17
+// 
+// SFML - Simple and Fast Multimedia Library
+// Copyright (X) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_PARALLEL_HPP
+#define SFML_PARALLEL_HPP
+
+#include <SFML/System/Arithmetic.hpp>
+#include <SFML/System/DynamicMatrix.hpp>
+#include <SFML/System/Matrix.hpp>
+#include <SFML/System/Table.hpp>
+#include <SFML/System/ThreadPool.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#if defined(_WIN32)
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+#elif defined(__linux__)
+	#include <unistd.h>
+#endif
+
+namespace sf
+{
+	namespace priv
+	{
+		// Returns the size in bytes of the level 2 cache of one core, asked
+		// of Windows or Linux. Elsewhere, or if the answer is unusable,
+		// returns 256 KiB, the smallest level 2 cache found on current
+		// desktop processors.
+		inline std::size_t cache_size()
+		{
+			static const std::size_t size = []
+			{
+				#if defined(_WIN32)
+					DWORD length = 0;
+					GetLogicalProcessorInformation(nullptr, &length);
+
+					if (length > 0)
+					{
+						std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> info(length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+
+						if (GetLogicalProcessorInformation(info.data(), &length))
+						{
+							for (const SYSTEM_LOGICAL_PROCESSOR_INFORMATION& entry : info)
+							{
+								if (entry.Relationship == RelationCache && entry.Cache.Level == 2
+									&& (entry.Cache.Type == CacheUnified || entry.Cache.Type == CacheData) && entry.Cache.Size > 0)
+									return static_cast<std::size_t>(entry.Cache.Size);
+							}
+						}
+					}
+				#elif defined(__linux__) && defined(_SC_LEVEL2_CACHE_SIZE)
+					long bytes = sysconf(_SC_LEVEL2_CACHE_SIZE);
+
+					if (bytes > 0)
+						return static_cast<std::size_t>(bytes);
+				#endif
+
+				return std::size_t(256u * 1024u);
+			}();
+
+			return size;
+		}
+
+		// Returns the number of elements each task of a parallel operation
+		// over count elements should take, where every element moves
+		// bytes_per_element bytes through the cache.
+		//
+		// A chunk is kept to half of the level 2 cache, so that it stays there
+		// while the task works through it, but is made smaller when that would
+		// leave fewer than four chunks per thread to balance between them.
+		inline std::size_t chunk_size(const ThreadPool& pool, std::size_t count, std::size_t bytes_per_element)
+		{
+			std::size_t cache_chunk = cache_size() / 2u / std::max<std::size_t>(bytes_per_element, 1u);
+			std::size_t chunk_count = pool.threadCount() * 4u;
+			std::size_t balance_chunk = (count + chunk_count - 1u) / chunk_count;
+
+			return std::max<std::size_t>(std::min(cache_chunk, balance_chunk), 1u);
+		}
+
+		// The elements of each container, in storage order.
+		template <arithmetic T, std::size_t X, std::size_t Y>
+		std::span<T> elements(::sf::Matrix<T, X, Y>& M)
+		{
+			return std::span<T>(M.data(), X * Y);
+		}
+
+		template <arithmetic T, std::size_t X, std::size_t Y>
+		std::span<const T> elements(const ::sf::Matrix<T, X, Y>& M)
+		{
+			return std::span<const T>(M.data(), X * Y);
+		}
+
+		template <arithmetic T>
+		std::span<T> elements(DynamicMatrix<T>& M)
+		{
+			return std::span<T>(M.data(), M.size());
+		}
+
+		template <arithmetic T>
+		std::span<const T> elements(const DynamicMatrix<T>& M)
+		{
+			return std::span<const T>(M.data(), M.size());
+		}
+
+		template <std::semiregular T>
+		std::span<T> elements(Table<T>& table)
+		{
+			return std::span<T>(table.data(), table.size());
+		}
+
+		template <std::semiregular T>
+		std::span<const T> elements(const Table<T>& table)
+		{
+			return std::span<const T>(table.data(), table.size());
+		}
+	}
+
+	// Calls function(first, last) over [0, count) split into chunks of
+	// chunk_size, spread over pool, and waits for all of them.
+	// Suits work that needs more than one element at a time, such as a
+	// Table updated row by row from the rows around it.
+	template <typename Function>
+	void parallel_for(ThreadPool& pool, std::size_t count, std::size_t chunk_size, Function function)
+	{
+		chunk_size = std::max<std::size_t>(chunk_size, 1u);
+
+		pool.run((count + chunk_size - 1u) / chunk_size, [&](std::size_t chunk)
+		{
+			std::size_t first = chunk * chunk_size;
+			function(first, std::min(first + chunk_size, count));
+		});
+	}
+
+	// Calls function(element) for every element of a Table,
+	// Matrix or DynamicMatrix, spread over pool.
+	template <typename Container, typename Function>
+	void parallel_for_each(ThreadPool& pool, Container& container, Function function)
+	{
+		auto elements = priv::elements(container);
+		std::size_t chunk = priv::chunk_size(pool, elements.size(), sizeof(elements[0]));
+
+		parallel_for(pool, elements.size(), chunk, [&](std::size_t first, std::size_t last)
+		{
+			for (std::size_t i(first); i < last; ++i)
+				function(elements[i]);
+		});
+	}
+
+	// Sets every element of output to function(element) of the matching
+	// element of input, spread over pool. input and output may be the same.
+	// Throws std::invalid_argument if they differ in size.
+	template <typename Input, typename Output, typename Function>
+	void parallel_transform(ThreadPool& pool, const Input& input, Output& output, Function function)
+	{
+		auto in = priv::elements(input);
+		auto out = priv::elements(output);
+
+		if (in.size() != out.size())
+			throw std::invalid_argument("Input and output differ in size");
+
+		std::size_t chunk = priv::chunk_size(pool, in.size(), sizeof(in[0]) + sizeof(out[0]));
+
+		parallel_for(pool, in.size(), chunk, [&](std::size_t first, std::size_t last)
+		{
+			for (std::size_t i(first); i < last; ++i)
+				out[i] = function(in[i]);
+		});
+	}
+
+	// Returns init combined with map(element) of every element of a Table,
+	// Matrix or DynamicMatrix through reduce, spread over pool.
+	//
+	// Each chunk is reduced on its own and the results of the chunks are
+	// then reduced in order, so reduce must be associative. The result only
+	// depends on the size of the pool where reduce is not exactly
+	// associative, as with floating point addition.
+	template <typename Container, typename T, typename Map, typename Reduce>
+	T parallel_map_reduce(ThreadPool& pool, const Container& container, T init, Map map, Reduce reduce)
+	{
+		auto elements = priv::elements(container);
+
+		if (elements.empty())
+			return init;
+
+		std::size_t chunk = priv::chunk_size(pool, elements.size(), sizeof(elements[0]));
+		std::size_t chunk_count = (elements.size() + chunk - 1u) / chunk;
+		std::vector<T> partials(chunk_count, init);
+
+		parallel_for(pool, elements.size(), chunk, [&](std::size_t first, std::size_t last)
+		{
+			T result = map(elements[first]);
+
+			for (std::size_t i(first + 1u); i < last; ++i)
+				result = reduce(result, map(elements[i]));
+
+			partials[first / chunk] = result;
+		});
+
+		for (const T& partial : partials)
+			init = reduce(init, partial);
+
+		return init;
+	}
+
+	// Returns init combined with every element of a Table, Matrix
+	// or DynamicMatrix through reduce, spread over pool.
+	// See parallel_map_reduce().
+	template <typename Container, typename T, typename Reduce>
+	T parallel_reduce(ThreadPool& pool, const Container& container, T init, Reduce reduce)
+	{
+		return parallel_map_reduce(pool, container, init, [](const auto& element) { return static_cast<T>(element); }, reduce);
+	}
+}
+
+#endif // SFML_PARALLEL_HPP
\ No newline at end of file
@@ -0,0 +1,269 @@
+////////////////////////////////////////////////////////////
+// 
+// This is an added file for this modified version of SFML 2.5.1
+// Modified by Justyn Durnford
+// Last modified on 2026-10-16
+// 
+// SFML - Simple and Fast Multimedia Library
+// Copyright (X) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_THREADPOOL_HPP
+#define SFML_THREADPOOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sf
+{
+	// A fixed set of worker threads that run tasks handed to them by run().
+	//
+	// Every worker has its own queue. A worker takes tasks from the back of
+	// its own queue and, once that is empty, steals from the front of the
+	// others', so a worker that finishes early takes over the work of one
+	// that is falling behind instead of sitting idle.
+	//
+	// The thread that calls run() works through the tasks alongside the
+	// workers, so a pool of N threads starts N - 1 of its own, and a task
+	// may itself call run() on the same pool without deadlocking.
+	class ThreadPool
+	{
+		struct Queue
+		{
+			std::mutex mutex;
+			std::deque<std::function<void()>> tasks;
+		};
+
+		// One Queue per worker, then one shared by the threads calling run().
+		std::vector<std::unique_ptr<Queue>> queues_;
+		std::vector<std::thread> threads_;
+		std::mutex mutex_;
+		std::condition_variable wake_;
+		std::atomic<std::size_t> queued_;
+		std::atomic<std::size_t> next_;
+		bool stopping_;
+
+		// Takes a task from the back of queue self, or else
+		// steals one from the front of another queue.
+		bool tryPop(std::size_t self, std::function<void()>& task)
+		{
+			{
+				Queue& own = *queues_[self];
+				std::lock_guard<std::mutex> lock(own.mutex);
+
+				if (!own.tasks.empty())
+				{
+					task = std::move(own.tasks.back());
+					own.tasks.pop_back();
+					queued_.fetch_sub(1u);
+					return true;
+				}
+			}
+
+			for (std::size_t i(1u); i < queues_.size(); ++i)
+			{
+				Queue& victim = *queues_[(self + i) % queues_.size()];
+				std::lock_guard<std::mutex> lock(victim.mutex);
+
+				if (!victim.tasks.empty())
+				{
+					task = std::move(victim.tasks.front());
+					victim.tasks.pop_front();
+					queued_.fetch_sub(1u);
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		//
+		void work(std::size_t self)
+		{
+			std::function<void()> task;
+
+			while (true)
+			{
+				if (tryPop(self, task))
+				{
+					task();
+					task = nullptr;
+					continue;
+				}
+
+				std::unique_lock<std::mutex> lock(mutex_);
+				wake_.wait(lock, [this] { return stopping_ || queued_.load() > 0u; });
+
+				if (stopping_ && queued_.load() == 0u)
+					return;
+			}
+		}
+
+		public:
+
+		// Constructs a ThreadPool of thread_count threads, counting the
+		// thread that calls run(). 0 uses one thread per hardware thread.
+		explicit ThreadPool(std::size_t thread_count = 0u)
+			: queued_(0u), next_(0u), stopping_(false)
+		{
+			if (thread_count == 0u)
+				thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+
+			for (std::size_t i(0u); i < thread_count; ++i)
+				queues_.push_back(std::make_unique<Queue>());
+
+			threads_.reserve(thread_count - 1u);
+
+			for (std::size_t i(0u); i < thread_count - 1u; ++i)
+				threads_.emplace_back(&ThreadPool::work, this, i);
+		}
+
+		ThreadPool(const ThreadPool& other) = delete;
+		ThreadPool& operator = (const ThreadPool& other) = delete;
+
+		// Lets the workers finish every queued task, then joins them.
+		~ThreadPool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				stopping_ = true;
+			}
+
+			wake_.notify_all();
+
+			for (std::thread& thread : threads_)
+				thread.join();
+		}
+
+		// Returns the number of threads that run() spreads work over,
+		// counting the calling thread.
+		std::size_t threadCount() const
+		{
+			return threads_.size() + 1u;
+		}
+
+		// Calls function(i) for every i in [0, count), spread over the pool,
+		// and returns once every call has finished. If any call throws, the
+		// first exception is rethrown here after the others have finished.
+		template <typename Function>
+		void run(std::size_t count, Function function)
+		{
+			if (count == 0u)
+				return;
+
+			if (threads_.empty() || count == 1u)
+			{
+				for (std::size_t i(0u); i < count; ++i)
+					function(i);
+
+				return;
+			}
+
+			std::atomic<std::size_t> remaining(count);
+			std::exception_ptr error;
+			std::mutex error_mutex;
+
+			auto task = [&](std::size_t i)
+			{
+				try
+				{
+					function(i);
+				}
+				catch (...)
+				{
+					std::lock_guard<std::mutex> lock(error_mutex);
+
+					if (!error)
+						error = std::current_exception();
+				}
+
+				remaining.fetch_sub(1u);
+			};
+
+			// Deal the tasks out in contiguous runs, one run per queue, so that
+			// neighbouring tasks, which usually touch neighbouring memory, start
+			// on the same thread and are only split up by stealing.
+			std::size_t queue_count = queues_.size();
+			std::size_t run_length = (count + queue_count - 1u) / queue_count;
+			std::size_t first_queue = next_.fetch_add(1u);
+
+			for (std::size_t q(0u); q < queue_count; ++q)
+			{
+				std::size_t first = q * run_length;
+				std::size_t last = std::min(first + run_length, count);
+
+				if (first >= last)
+					break;
+
+				Queue& queue = *queues_[(first_queue + q) % queue_count];
+				std::lock_guard<std::mutex> lock(queue.mutex);
+
+				// Pushed in reverse, so that the owner, which takes from the
+				// back, runs them in order and thieves take the far end.
+				for (std::size_t i(last); i-- > first;)
+					queue.tasks.emplace_back([&task, i] { task(i); });
+
+				queued_.fetch_add(last - first);
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+			}
+
+			wake_.notify_all();
+
+			std::function<void()> stolen;
+
+			while (remaining.load() > 0u)
+			{
+				if (tryPop(queue_count - 1u, stolen))
+				{
+					stolen();
+					stolen = nullptr;
+				}
+				else
+					std::this_thread::yield();
+			}
+
+			if (error)
+				std::rethrow_exception(error);
+		}
+
+		// Returns a ThreadPool with one thread per hardware thread,
+		// created the first time it is asked for.
+		static ThreadPool& global()
+		{
+			static ThreadPool pool;
+			return pool;
+		}
+	};
+}
+
+#endif // SFML_THREADPOOL_HPP
\ No newline at end of file
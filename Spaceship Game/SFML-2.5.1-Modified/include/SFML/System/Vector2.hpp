@@ -2,7 +2,7 @@
 // 
 // This is a modified version of the SFML 2.5.1 file Vector2.hpp
 // Modified by Justyn Durnford
-// Last modified on 2021-05-11
+// Last modified on 2026-10-17
 // 
 // SFML - Simple and Fast Multimedia Library
 // Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
@@ -45,38 +45,26 @@ namespace sf
         T y;
 
         // \brief Default constructor.
-        // Creates a Vector2(0, 0).
-        Vector2()
-        {
-            x = static_cast<T>(0);
-            y = static_cast<T>(0);
-        }
+        // Leaves x and y uninitialised so that Vector2 stays trivial.
+        // Vector2() and Vector2{} still create a Vector2(0, 0).
+        Vector2() = default;
 
         // \brief Constructs the Vector2 from the given coordinates.
         // \param X: X coordinate
         // \param Y: Y coordinate
-        Vector2(T X, T Y)
-        {
-            x = X;
-            y = Y;
-        }
+        constexpr Vector2(T X, T Y)
+            : x(X), y(Y) {}
 
         // \brief Constructs the Vector2 from the given Point2.
         // \param P: Point2 to copy the coordinates from 
-        Vector2(const Point2<T>& P)
-        {
-            x = P.x;
-            y = P.y;
-        }
+        constexpr Vector2(const Point2<T>& P)
+            : x(P.x), y(P.y) {}
 
         // \brief Constructs the Vector2 as the displacement vector of the two Point2s.
         // \param A: First Point2
         // \param B: Second Point2
-        Vector2(const Point2<T>& A, const Point2<T>& B)
-        {
-            x = B.x - A.x;
-            y = B.y - A.y;
-        }
+        constexpr Vector2(const Point2<T>& A, const Point2<T>& B)
+            : x(B.x - A.x), y(B.y - A.y) {}
 
         // \brief Construct the Vector2 from another type of Vector2.
         //
@@ -87,15 +75,12 @@ namespace sf
         //
         // \param other: Vector2 to convert
         template <typename U>
-        explicit Vector2(const Vector2<U>& other)
-        {
-            x = static_cast<T>(other.x);
-            y = static_cast<T>(other.y);
-        }
+        constexpr explicit Vector2(const Vector2<U>& other)
+            : x(static_cast<T>(other.x)), y(static_cast<T>(other.y)) {}
 
         // \brief Assigns the Vector2 from the given Point2.
         // \param P: Point2 to copy the coordinates from 
-        Vector2& operator = (const Point2<T>& P)
+        constexpr Vector2& operator = (const Point2<T>& P)
         {
             x = P.x;
             y = P.y;
@@ -103,14 +88,25 @@ namespace sf
             return *this;
         }
 
+        // \brief Returns the squared magnitude of the Vector2.
+        // Cheaper than magnitude(), and orders magnitudes the same way.
+        constexpr float squaredMagnitude() const
+        {
+            float fx = static_cast<float>(x);
+            float fy = static_cast<float>(y);
+
+            return fx * fx + fy * fy;
+        }
+
         // \brief Returns the magnitude of the Vector2.
+        // See VectorMath.hpp for magnitudes over whole arrays of Vector2f.
         float magnitude() const
         {
-            return std::sqrt(std::pow(x, 2) + std::pow(y, 2));
+            return std::sqrt(squaredMagnitude());
         }
 
         // \brief Returns the endpoint of the Point2.
-        Point2<T> endpoint() const
+        constexpr Point2<T> endpoint() const
         {
             return Point2<T>(x, y);
         }
@@ -131,7 +127,7 @@ namespace sf
 
     // \brief Returns the dot product of the 2 given Vector2s.
     template <typename T, typename U, typename V>
-    T dot_product(const Vector2<U>& A, const Vector2<V>& B)
+    constexpr T dot_product(const Vector2<U>& A, const Vector2<V>& B)
     {
         return static_cast<T>(A.x * B.x + A.y * B.y);
     }
@@ -140,14 +136,14 @@ namespace sf
     template <typename T, typename U>
     double scalar_proj(const Vector2<T>& A, const Vector2<U>& B)
     {
-        return dot_product(A, B) / A.magnitude();
+        return dot_product<float>(A, B) / A.magnitude();
     }
 
     // \brief Returns the vector projection of A onto B.
     template <typename T, typename U>
     Vector2<float> vector_proj(const Vector2<T>& A, const Vector2<T>& B)
     {
-        float f = (dot_product(A, B) * 1.f / dot_product(A, A) * 1.f);
+        float f = (dot_product<float>(A, B) * 1.f / dot_product<float>(A, A) * 1.f);
         return Vector2<float>(A.x * f, A.y * f);
     }
 
@@ -157,7 +153,7 @@ namespace sf
     template <typename T, typename U>
     bool are_normal(const Vector2<T>& A, const Vector2<U>& B)
     {
-        return dot_product(A, B) == 0.f;
+        return dot_product<float>(A, B) == 0.f;
     }
 
     // Define common types
@@ -168,53 +164,57 @@ namespace sf
     typedef sf::Vector2<int>            Vector2i;
     typedef sf::Vector2<unsigned int>   Vector2u;
     typedef sf::Vector2<float>          Vector2f;
+
+    static_assert(std::is_trivial_v<Vector2f>, "Vector2f must be trivial");
+    static_assert(std::is_standard_layout_v<Vector2f>, "Vector2f must be standard layout");
+    static_assert(sizeof(Vector2f) == 2u * sizeof(float), "Vector2f must be two packed floats");
 }
 
 // \brief Overload of unary operator -
 template <typename T> 
-sf::Vector2<T> operator - (const sf::Vector2<T>& A)
+constexpr sf::Vector2<T> operator - (const sf::Vector2<T>& A)
 {
     return sf::Vector2<T>(-A.x, -A.y);
 }
 
 // \brief Overload of binary operator +
 template <typename T> 
-sf::Vector2<T> operator + (const sf::Vector2<T>& A, const sf::Vector2<T>& B)
+constexpr sf::Vector2<T> operator + (const sf::Vector2<T>& A, const sf::Vector2<T>& B)
 {
     return sf::Vector2<T>(A.x + B.x, A.y + B.y);
 }
 
 // \brief Overload of binary operator -
 template <typename T>
-sf::Vector2<T> operator - (const sf::Vector2<T>& A, const sf::Vector2<T>& B)
+constexpr sf::Vector2<T> operator - (const sf::Vector2<T>& A, const sf::Vector2<T>& B)
 {
     return sf::Vector2<T>(A.x - B.x, A.y - B.y);
 }
 
 // \brief Overload of binary operator *
 template <typename T, typename U>
-sf::Vector2<T> operator * (const sf::Vector2<T>& A, U B)
+constexpr sf::Vector2<T> operator * (const sf::Vector2<T>& A, U B)
 {
     return sf::Vector2<T>(A.x * B, A.y * B);
 }
 
 // \brief Overload of binary operator *
 template <typename T, typename U>
-sf::Vector2<T> operator * (U A, const sf::Vector2<T>& B)
+constexpr sf::Vector2<T> operator * (U A, const sf::Vector2<T>& B)
 {
     return sf::Vector2<T>(B.x * A, B.y * A);
 }
 
 // \brief Overload of binary operator /
 template <typename T, typename U>
-sf::Vector2<T> operator / (const sf::Vector2<T>& A, U B)
+constexpr sf::Vector2<T> operator / (const sf::Vector2<T>& A, U B)
 {
     return sf::Vector2<T>(A.x / B, A.y / B);
 }
 
 // \brief Overload of binary operator +=
 template <typename T>
-sf::Vector2<T>& operator += (sf::Vector2<T>& A, const sf::Vector2<T>& B)
+constexpr sf::Vector2<T>& operator += (sf::Vector2<T>& A, const sf::Vector2<T>& B)
 {
     A.x += B.x;
     A.y += B.y;
@@ -224,7 +224,7 @@ sf::Vector2<T>& operator += (sf::Vector2<T>& A, const sf::Vector2<T>& B)
 
 // \brief Overload of binary operator -=
 template <typename T>
-sf::Vector2<T>& operator -= (sf::Vector2<T>& A, const sf::Vector2<T>& B)
+constexpr sf::Vector2<T>& operator -= (sf::Vector2<T>& A, const sf::Vector2<T>& B)
 {
     A.x -= B.x;
     A.y -= B.y;
@@ -234,7 +234,7 @@ sf::Vector2<T>& operator -= (sf::Vector2<T>& A, const sf::Vector2<T>& B)
 
 // \brief Overload of binary operator *=
 template <typename T, typename U>
-sf::Vector2<T>& operator *= (sf::Vector2<T>& A, U B)
+constexpr sf::Vector2<T>& operator *= (sf::Vector2<T>& A, U B)
 {
     A.x *= B;
     A.y *= B;
@@ -244,7 +244,7 @@ sf::Vector2<T>& operator *= (sf::Vector2<T>& A, U B)
 
 // \brief Overload of binary operator /=
 template <typename T, typename U>
-sf::Vector2<T>& operator /= (sf::Vector2<T>& A, U B)
+constexpr sf::Vector2<T>& operator /= (sf::Vector2<T>& A, U B)
 {
     A.x /= B;
     A.y /= B;
@@ -254,14 +254,14 @@ sf::Vector2<T>& operator /= (sf::Vector2<T>& A, U B)
 
 // \brief Overload of binary operator ==
 template <typename T, typename U>
-bool operator == (const sf::Vector2<T>& A, const sf::Vector2<U>& B)
+constexpr bool operator == (const sf::Vector2<T>& A, const sf::Vector2<U>& B)
 {
     return (A.x == B.x) && (A.y == B.y);
 }
 
 // \brief Overload of binary operator !=
 template <typename T, typename U>
-bool operator != (const sf::Vector2<T>& A, const sf::Vector2<U>& B)
+constexpr bool operator != (const sf::Vector2<T>& A, const sf::Vector2<U>& B)
 {
     return (A.x != B.x) || (A.y != B.y);
 }
@@ -2,20 +2,23 @@
 // Entity.h
 // Justyn Durnford
 // Created on 2021-05-07
-// Last modified on 2021-05-13
+// Last modified on 2026-10-17
 // Header file for the Entity class.
 
 #pragma once
 
 #include "Define.h"
 
+// A single object with its own Sprite.
+// The game keeps its entities in an EntityStore instead; Player remains
+// as the one-object-at-a-time baseline measured by the Benchmark target.
 class Entity
 {
 	public:
 
 	Texture* texturePtr;
 	Sprite sprite;
-	Vector2f velocity;
+	Vector2f velocity = Vector2f(0.f, 0.f);
 
 	//
 	Entity();
@@ -37,7 +40,4 @@ class Entity
 
 	//
 	Entity(Texture* texture_ptr, const IntRect& sprite_rect, const Point2f& pos);
-
-	//
-	virtual void update(Time dt) = 0;
 };
\ No newline at end of file
@@ -0,0 +1,112 @@
+// Spaceship Game
+// EntityStore.h
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-17
+// Header file for the EntityStore class.
+
+#pragma once
+
+#include "Define.h"
+
+#include <vector>
+
+// Returns a float in [0, 1) built from the top 24 bits of one draw of engine.
+// Unlike uniform_real_distribution, the mapping is fixed, so a seed
+// gives the same values with every standard library.
+float random_unit(mt19937& engine);
+
+// Returns a number in [0, n) from one draw of engine, with a fixed mapping.
+uint32_t random_below(mt19937& engine, uint32_t n);
+
+// The part of a Texture an entity is drawn with.
+struct SpriteInfo
+{
+	const Texture* texture;
+	IntRect rect;
+};
+
+// Stores every entity as one row across a set of parallel arrays
+// (structure of arrays), so that updating a single property of every
+// entity walks one contiguous array instead of hopping between objects.
+//
+// Entities are identified by their row index. destroy() moves the last
+// row into the freed one, so indices are only stable until the next
+// destroy().
+//
+// The positions from before the latest step are kept as well, so that
+// draw() can blend between the last two steps of a fixed timestep loop.
+class EntityStore
+{
+	vector<SpriteInfo> sprites_;
+
+	public:
+
+	vector<float> xPos;
+	vector<float> yPos;
+	vector<float> xPrev;
+	vector<float> yPrev;
+	vector<float> xVel;
+	vector<float> yVel;
+	vector<float> width;
+	vector<float> height;
+	vector<uint32_t> spriteIndex;
+	vector<uint32_t> turnChance;
+
+	//
+	EntityStore();
+
+	// Registers the whole of texture as a sprite and returns its index.
+	uint32_t addSprite(const Texture* texture);
+
+	// Registers part of texture as a sprite and returns its index.
+	// texture may be null if the store is never drawn.
+	uint32_t addSprite(const Texture* texture, const IntRect& rect);
+
+	// Changes the Texture a sprite is drawn from.
+	void setTexture(uint32_t sprite_index, const Texture* texture);
+
+	// Changes the Texture a sprite is drawn from, and the part of it.
+	// Entities keep their size, so rect should be as large as the old one.
+	void setTexture(uint32_t sprite_index, const Texture* texture, const IntRect& rect);
+
+	// Reserves room for count entities.
+	void reserve(size_t count);
+
+	// Adds an entity at (x_pos, y_pos) with no velocity and returns its index.
+	size_t create(uint32_t sprite_index, float x_pos, float y_pos);
+
+	// Removes the entity at index i by moving the last entity into its place.
+	void destroy(size_t i);
+
+	// Removes every entity. Registered sprites are kept.
+	void clear();
+
+	// Returns the number of entities.
+	size_t size() const;
+
+	// Remembers the current positions as the previous ones.
+	// Call once at the start of every step.
+	void savePositions();
+
+	// Moves every entity by its velocity.
+	void integrate(Time dt);
+
+	// Removes every entity that lies entirely outside bounds.
+	void destroyOutside(const FloatRect& bounds);
+
+	// Moves every entity by its velocity, then clamps it so that
+	// it lies entirely within bounds. See integrate_clamp().
+	void move(Time dt, const FloatRect& bounds);
+
+	// Gives entities in [first, last) a new random heading at the given speed.
+	// An entity's chance of turning grows every update until it turns.
+	// Headings are one of 64 evenly spaced directions taken from a fixed
+	// table, so that replays do not depend on the platform's cos and sin.
+	void steer(size_t first, size_t last, float speed, mt19937& engine);
+
+	// Adds every entity to batch, grouped by sprite so that each sprite
+	// takes one draw call, at alpha of the way from its previous position
+	// to its current one. Entities whose sprite has no texture are skipped.
+	void draw(SpriteBatch& batch, float alpha = 1.f) const;
+};
\ No newline at end of file
@@ -2,23 +2,53 @@
 // Game.h
 // Justyn Durnford
 // Created on 2021-05-07
-// Last modified on 2021-05-13
+// Last modified on 2026-10-17
 // Header file for the Game class.
 
 #pragma once
 
-#include "Entity.h"
-#include "Player.h"
+#include "InputRecording.h"
+#include "Simulation.h"
 
-extern Texture player_spaceship_texture;
-extern Texture enemy_spaceship_texture;
+// Every sprite of the game is packed into this one texture, so that a
+// whole frame is drawn with one draw call.
+extern Texture atlas_texture;
+extern IntRect player_sprite_rect;
+extern IntRect enemy_sprite_rect;
+extern IntRect projectile_sprite_rect;
 
+// Total time spent in each phase of the main loop, and the number of sprites drawn.
+struct PhaseTimes
+{
+	Time events;
+	Time update;
+	Time render;
+	uint64_t frames = 0u;
+	uint64_t steps = 0u;
+	uint64_t droppedSteps = 0u;
+	uint64_t sprites = 0u;
+};
+
+// Runs the Simulation in fixed steps of time_step, however long each frame
+// takes, and draws it blended between the last two steps. After a stall,
+// at most max_steps_per_frame steps are run to catch up and the rest of
+// the lost time is dropped, so that a slow frame cannot snowball.
+//
+// While recording, every change to the controls is kept along with the
+// step it came before, so that the Benchmark target can replay the game
+// headless and reach exactly the same state.
 class Game
 {
 	RenderWindow window_;
 	Event event_;
-	map<Keyboard::Key, bool> keyboardInput_;
-	Player player_;
+	Controls controls_;
+	uint32_t seed_;
+	Simulation simulation_;
+	InputRecording recording_;
+	string recordingFile_;
+	Sprite playerSprite_;
+	SpriteBatch batch_;
+	PhaseTimes times_;
 
 	//
 	void processEvents();
@@ -29,14 +59,19 @@ class Game
 	//
 	void update(Time dt);
 
-	//
-	void render();
+	// Draws the state alpha of the way from the previous step to the latest one.
+	void render(float alpha);
 
 	public:
 
-	//
-	Game(uint32_t width, uint32_t height);
+	const static uint32_t max_steps_per_frame = 5u;
+
+	// Creates a Game whose Simulation is started with seed.
+	Game(uint32_t width, uint32_t height, uint32_t seed);
+
+	// Records the game, and saves the recording to filename once run() returns.
+	void startRecording(const string& filename);
 
 	//
 	void run();
-};
\ No newline at end of file
+};
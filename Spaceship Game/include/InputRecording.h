@@ -0,0 +1,48 @@
+// Spaceship Game
+// InputRecording.h
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Header file for the InputRecording class.
+
+#pragma once
+
+#include "Define.h"
+
+#include <vector>
+
+// A control key that was pressed or released before the given step.
+struct KeyEvent
+{
+	uint64_t step;
+	Keyboard::Key key;
+	bool pressed;
+};
+
+// Everything needed to replay a game exactly: the seed of its Simulation
+// and every change to the control keys, along with the number of steps
+// and a checksum of the final state to check the replay against.
+//
+// Saved as text, one item per line:
+//   seed <n>
+//   steps <n>
+//   checksum <hex>
+//   key <step> <key code> <1 if pressed, 0 if released>
+class InputRecording
+{
+	public:
+
+	uint32_t seed;
+	uint64_t steps;
+	uint64_t checksum;
+	vector<KeyEvent> events;
+
+	//
+	InputRecording();
+
+	// Returns false if the file could not be written.
+	bool saveToFile(const string& filename) const;
+
+	// Returns false if the file could not be read or is malformed.
+	bool loadFromFile(const string& filename);
+};
\ No newline at end of file
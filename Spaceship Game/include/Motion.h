@@ -0,0 +1,27 @@
+// Spaceship Game
+// Motion.h
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Header file for the batch motion kernels.
+
+#pragma once
+
+#include "Define.h"
+
+// Moves n positions along one axis by their velocities over dt seconds,
+// then clamps position i to [lower, upper - size[i]], so that an entity
+// of that size stays entirely within [lower, upper].
+//
+// Uses AVX when the compiler targets it (/arch:AVX or -mavx), otherwise
+// SSE on x86 and x64, otherwise integrate_clamp_scalar(). Every version
+// gives exactly the same results.
+void integrate_clamp(float* pos, const float* vel, const float* size, size_t n,
+                     float dt, float lower, float upper);
+
+// Portable version of integrate_clamp(), one position at a time.
+void integrate_clamp_scalar(float* pos, const float* vel, const float* size, size_t n,
+                            float dt, float lower, float upper);
+
+// Returns the name of the instruction set integrate_clamp() uses.
+const char* integrate_clamp_isa();
\ No newline at end of file
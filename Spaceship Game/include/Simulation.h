@@ -0,0 +1,76 @@
+// Spaceship Game
+// Simulation.h
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-17
+// Header file for the Simulation class.
+
+#pragma once
+
+#include "EntityStore.h"
+#include "SpatialHash.h"
+
+// Length of one simulation step. Game always steps by exactly this much.
+const Time time_step = microseconds(16667);
+
+// The controls held down during one step.
+struct Controls
+{
+	bool up = false;
+	bool left = false;
+	bool down = false;
+	bool right = false;
+	bool fire = false;
+
+	// Presses or releases the control bound to key:
+	// W, A, S, D to move and Space to fire.
+	// Returns false if key is not bound to a control.
+	bool setKey(Keyboard::Key key, bool is_pressed);
+
+	//
+	bool operator == (const Controls& other) const = default;
+};
+
+// Everything in the game that changes over time, kept apart from the
+// window and the textures so that it can run headless.
+//
+// Given the same seed, and the same Controls and dt for every step, a
+// Simulation always goes through exactly the same states, on any platform:
+// the random numbers come from mt19937 through fixed mappings, and no step
+// calls cos, sin or any other function whose result varies by C library.
+class Simulation
+{
+	SpatialHash enemyGrid_;
+	vector<uint32_t> hits_;
+	Time fireCooldown_;
+	mt19937 rng_;
+	uint64_t steps_;
+
+	// Destroys enemies hit by the player or a projectile, and the projectiles that hit them.
+	void checkCollisions();
+
+	public:
+
+	const static uint32_t ENEMY_COUNT = 1000u;
+
+	Vector2f playerPos;
+	Vector2f playerPrev;
+	Vector2f playerVel;
+	Vector2f playerSize;
+	EntityStore enemies;
+	EntityStore projectiles;
+
+	// Creates the starting state, with enemies placed using seed.
+	// Each EntityStore has one sprite, index 0, with no Texture.
+	Simulation(uint32_t seed);
+
+	// Advances the simulation by dt.
+	void step(const Controls& controls, Time dt);
+
+	// Returns the number of steps taken.
+	uint64_t steps() const;
+
+	// Mixes every position into one number, so that two runs
+	// can be compared for determinism.
+	uint64_t checksum() const;
+};
\ No newline at end of file
@@ -0,0 +1,63 @@
+// Spaceship Game
+// SpatialHash.h
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Header file for the SpatialHash class.
+
+#pragma once
+
+#include "EntityStore.h"
+
+// Uniform grid broadphase over the entities of an EntityStore.
+//
+// build() files every entity under the cell holding its top left corner,
+// using a counting sort, so the entities of a cell are contiguous and a
+// rebuild costs O(n) with no per-cell allocations. The boxes are copied in
+// cell order, so a query reads them straight from its own arrays. Queries
+// widen their area by the largest entity size to catch entities that reach
+// in from neighbouring cells, then test each candidate box exactly.
+//
+// Positions outside the grid bounds are filed under the nearest edge cell,
+// so they are still found, just less efficiently. The cell size should be
+// at least the size of a typical entity.
+class SpatialHash
+{
+	FloatRect bounds_;
+	float cellSize_;
+	uint32_t columns_;
+	uint32_t rows_;
+	float maxWidth_;
+	float maxHeight_;
+	vector<uint32_t> cellStart_;
+	vector<uint32_t> cellOf_;
+	vector<uint32_t> index_;
+	vector<float> left_;
+	vector<float> top_;
+	vector<float> right_;
+	vector<float> bottom_;
+
+	// Returns the column of x, clamped to the grid.
+	uint32_t columnOf(float x) const;
+
+	// Returns the row of y, clamped to the grid.
+	uint32_t rowOf(float y) const;
+
+	public:
+
+	// Creates a grid covering bounds with square cells of cell_size.
+	SpatialHash(const FloatRect& bounds, float cell_size);
+
+	// Refiles every entity of store. Any previous contents are discarded.
+	void build(const EntityStore& store);
+
+	// Appends the index of every entity whose box overlaps area to result.
+	// area must not have a negative width or height.
+	void query(const FloatRect& area, vector<uint32_t>& result) const;
+
+	// Appends the index of every entity whose box is within radius of center.
+	void queryRadius(const Vector2f& center, float radius, vector<uint32_t>& result) const;
+
+	// Returns the number of entities filed by the last build().
+	size_t size() const;
+};
\ No newline at end of file
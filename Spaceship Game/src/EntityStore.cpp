@@ -0,0 +1,226 @@
+// Spaceship Game
+// EntityStore.cpp
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-17
+// Source file for the EntityStore class.
+
+#include "EntityStore.h"
+#include "Motion.h"
+
+// See Simulation.cpp: no multiply-adds, so steps round the same on every build.
+SFML_VECTORMATH_CONTRACT_OFF
+
+// sin(k * 2pi / 64) for k in [0, 16]. The other three quarters follow by symmetry.
+const float quarter_sine[17] =
+{
+	0.000000000f, 0.098017140f, 0.195090322f, 0.290284677f,
+	0.382683432f, 0.471396737f, 0.555570233f, 0.634393284f,
+	0.707106781f, 0.773010453f, 0.831469612f, 0.881921264f,
+	0.923879533f, 0.956940336f, 0.980785280f, 0.995184727f,
+	1.000000000f
+};
+
+// Returns sin(k * 2pi / 64).
+float heading_sine(uint32_t k)
+{
+	k &= 63u;
+	uint32_t r = k & 15u;
+	float s = (k & 16u) ? quarter_sine[16u - r] : quarter_sine[r];
+	return (k & 32u) ? -s : s;
+}
+
+float random_unit(mt19937& engine)
+{
+	return static_cast<float>(engine() >> 8) * (1.f / 16777216.f);
+}
+
+uint32_t random_below(mt19937& engine, uint32_t n)
+{
+	return static_cast<uint32_t>((static_cast<uint64_t>(engine()) * n) >> 32);
+}
+
+EntityStore::EntityStore() {}
+
+uint32_t EntityStore::addSprite(const Texture* texture)
+{
+	Vector2u size = texture->getSize();
+	return addSprite(texture, IntRect(0, 0, static_cast<int>(size.x), static_cast<int>(size.y)));
+}
+
+uint32_t EntityStore::addSprite(const Texture* texture, const IntRect& rect)
+{
+	sprites_.push_back({ texture, rect });
+	return static_cast<uint32_t>(sprites_.size() - 1u);
+}
+
+void EntityStore::setTexture(uint32_t sprite_index, const Texture* texture)
+{
+	sprites_[sprite_index].texture = texture;
+}
+
+void EntityStore::setTexture(uint32_t sprite_index, const Texture* texture, const IntRect& rect)
+{
+	sprites_[sprite_index] = { texture, rect };
+}
+
+void EntityStore::reserve(size_t count)
+{
+	xPos.reserve(count);
+	yPos.reserve(count);
+	xPrev.reserve(count);
+	yPrev.reserve(count);
+	xVel.reserve(count);
+	yVel.reserve(count);
+	width.reserve(count);
+	height.reserve(count);
+	spriteIndex.reserve(count);
+	turnChance.reserve(count);
+}
+
+size_t EntityStore::create(uint32_t sprite_index, float x_pos, float y_pos)
+{
+	const IntRect& rect = sprites_[sprite_index].rect;
+
+	xPos.push_back(x_pos);
+	yPos.push_back(y_pos);
+	xPrev.push_back(x_pos);
+	yPrev.push_back(y_pos);
+	xVel.push_back(0.f);
+	yVel.push_back(0.f);
+	width.push_back(static_cast<float>(rect.width));
+	height.push_back(static_cast<float>(rect.height));
+	spriteIndex.push_back(sprite_index);
+	turnChance.push_back(0u);
+
+	return xPos.size() - 1u;
+}
+
+void EntityStore::destroy(size_t i)
+{
+	size_t last = xPos.size() - 1u;
+
+	xPos[i] = xPos[last];
+	yPos[i] = yPos[last];
+	xPrev[i] = xPrev[last];
+	yPrev[i] = yPrev[last];
+	xVel[i] = xVel[last];
+	yVel[i] = yVel[last];
+	width[i] = width[last];
+	height[i] = height[last];
+	spriteIndex[i] = spriteIndex[last];
+	turnChance[i] = turnChance[last];
+
+	xPos.pop_back();
+	yPos.pop_back();
+	xPrev.pop_back();
+	yPrev.pop_back();
+	xVel.pop_back();
+	yVel.pop_back();
+	width.pop_back();
+	height.pop_back();
+	spriteIndex.pop_back();
+	turnChance.pop_back();
+}
+
+void EntityStore::clear()
+{
+	xPos.clear();
+	yPos.clear();
+	xPrev.clear();
+	yPrev.clear();
+	xVel.clear();
+	yVel.clear();
+	width.clear();
+	height.clear();
+	spriteIndex.clear();
+	turnChance.clear();
+}
+
+size_t EntityStore::size() const
+{
+	return xPos.size();
+}
+
+void EntityStore::savePositions()
+{
+	xPrev = xPos;
+	yPrev = yPos;
+}
+
+void EntityStore::integrate(Time dt)
+{
+	float s = dt.asSeconds();
+	size_t n = xPos.size();
+
+	for (size_t i = 0; i < n; ++i)
+		xPos[i] += xVel[i] * s;
+	for (size_t i = 0; i < n; ++i)
+		yPos[i] += yVel[i] * s;
+}
+
+void EntityStore::destroyOutside(const FloatRect& bounds)
+{
+	float right = bounds.left + bounds.width;
+	float bottom = bounds.top + bounds.height;
+
+	// Walk backwards so the entity moved into a freed row was already checked.
+	for (size_t i = xPos.size(); i-- > 0u;)
+	{
+		if (xPos[i] + width[i] <= bounds.left || xPos[i] >= right
+			|| yPos[i] + height[i] <= bounds.top || yPos[i] >= bottom)
+			destroy(i);
+	}
+}
+
+void EntityStore::move(Time dt, const FloatRect& bounds)
+{
+	float s = dt.asSeconds();
+	size_t n = xPos.size();
+
+	integrate_clamp(xPos.data(), xVel.data(), width.data(), n, s, bounds.left, bounds.left + bounds.width);
+	integrate_clamp(yPos.data(), yVel.data(), height.data(), n, s, bounds.top, bounds.top + bounds.height);
+}
+
+void EntityStore::steer(size_t first, size_t last, float speed, mt19937& engine)
+{
+	for (size_t i = first; i < last; ++i)
+	{
+		turnChance[i] = min(turnChance[i] + 5u, 9999u);
+
+		if (turnChance[i] > random_below(engine, 10000u))
+		{
+			uint32_t heading = random_below(engine, 64u);
+			xVel[i] = speed * heading_sine(heading + 16u);
+			yVel[i] = speed * heading_sine(heading);
+			turnChance[i] = 0u;
+		}
+	}
+}
+
+void EntityStore::draw(SpriteBatch& batch, float alpha) const
+{
+	size_t n = xPos.size();
+
+	// One pass per sprite, so that each sprite's entities form one run of the batch.
+	for (uint32_t s = 0; s < sprites_.size(); ++s)
+	{
+		const SpriteInfo& sprite = sprites_[s];
+
+		if (sprite.texture == nullptr)
+			continue;
+
+		for (size_t i = 0; i < n; ++i)
+		{
+			if (spriteIndex[i] != s)
+				continue;
+
+			float left = xPrev[i] + (xPos[i] - xPrev[i]) * alpha;
+			float top = yPrev[i] + (yPos[i] - yPrev[i]) * alpha;
+
+			batch.add(*sprite.texture, sprite.rect, Vector2f(left, top));
+		}
+	}
+}
+
+SFML_VECTORMATH_CONTRACT_RESTORE
\ No newline at end of file
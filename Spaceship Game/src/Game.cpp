@@ -2,13 +2,29 @@
 // Game.cpp
 // Justyn Durnford
 // Created on 2021-05-03
-// Last modified on 2021-05-15
+// Last modified on 2026-10-17
 // Source file for the Game class.
 
 #include "Game.h"
 
-Texture player_spaceship_texture;
-Texture enemy_spaceship_texture;
+#include <iomanip>
+
+Texture atlas_texture;
+IntRect player_sprite_rect;
+IntRect enemy_sprite_rect;
+IntRect projectile_sprite_rect;
+
+// Average time of one frame in milliseconds.
+inline double per_frame_ms(Time total, uint64_t frames)
+{
+	return frames == 0u ? 0.0 : total.asMicroseconds() / 1000.0 / frames;
+}
+
+// Average count per frame.
+inline double per_frame(uint64_t count, uint64_t frames)
+{
+	return frames == 0u ? 0.0 : static_cast<double>(count) / frames;
+}
 
 void Game::processEvents()
 {
@@ -36,72 +52,115 @@ void Game::processEvents()
 
 void Game::handleKeyboardInput(Keyboard::Key key, bool is_pressed)
 {
-	switch (key)
+	if (key == Keyboard::Key::Escape)
+	{
+		window_.close();
+		return;
+	}
+
+	Controls before = controls_;
+
+	// Held keys repeat, so only record the presses that change something.
+	if (controls_.setKey(key, is_pressed) && !recordingFile_.empty())
 	{
-		case Keyboard::Key::W:
-			keyboardInput_[key] = is_pressed;
-			break;
-		case Keyboard::Key::A:
-			keyboardInput_[key] = is_pressed;
-			break;
-		case Keyboard::Key::S:
-			keyboardInput_[key] = is_pressed;
-			break;
-		case Keyboard::Key::D:
-			keyboardInput_[key] = is_pressed;
-			break;
-		case Keyboard::Key::Escape:
-			window_.close();
-			break;
-		default:
-			break;
+		if (controls_ != before)
+			recording_.events.push_back({ simulation_.steps(), key, is_pressed });
 	}
 }
 
 void Game::update(Time dt)
 {
-	player_.velocity.x = 0.f;
-	player_.velocity.y = 0.f;
-
-	if (keyboardInput_[Keyboard::Key::W])
-		player_.velocity.y -= 400.f;
-	if (keyboardInput_[Keyboard::Key::A])
-		player_.velocity.x -= 400.f;
-	if (keyboardInput_[Keyboard::Key::S])
-		player_.velocity.y += 400.f;
-	if (keyboardInput_[Keyboard::Key::D])
-		player_.velocity.x += 400.f;
-
-	player_.update(dt);
+	simulation_.step(controls_, dt);
 }
 
-void Game::render()
+void Game::render(float alpha)
 {
+	Vector2f prev = simulation_.playerPrev;
+	Vector2f pos = simulation_.playerPos;
+	playerSprite_.setPosition(prev + (pos - prev) * alpha);
+
+	batch_.clear();
+	simulation_.enemies.draw(batch_, alpha);
+	simulation_.projectiles.draw(batch_, alpha);
+	batch_.add(playerSprite_);
+	times_.sprites += batch_.spriteCount();
+
 	window_.clear();
-	window_.draw(player_.sprite);
+	window_.draw(batch_);
 	window_.display();
 }
 
-Game::Game(uint32_t width, uint32_t height)
+Game::Game(uint32_t width, uint32_t height, uint32_t seed)
 	: window_(VideoMode(width, height), "Spaceship Game", Style::Titlebar | Style::Close),
-	  player_(&player_spaceship_texture, window_width / 2.f, window_height / 2.f)
+	  seed_(seed),
+	  simulation_(seed),
+	  playerSprite_(atlas_texture, player_sprite_rect)
 {
-	keyboardInput_[Keyboard::Key::W] = false;
-	keyboardInput_[Keyboard::Key::A] = false;
-	keyboardInput_[Keyboard::Key::S] = false;
-	keyboardInput_[Keyboard::Key::D] = false;
-
 	window_.setFramerateLimit(60);
+
+	simulation_.enemies.setTexture(0u, &atlas_texture, enemy_sprite_rect);
+	simulation_.projectiles.setTexture(0u, &atlas_texture, projectile_sprite_rect);
+}
+
+void Game::startRecording(const string& filename)
+{
+	recording_ = InputRecording();
+	recording_.seed = seed_;
+	recordingFile_ = filename;
 }
 
 void Game::run()
 {
 	Clock clock;
+	Clock phase_clock;
+	Time accumulator = Time::Zero;
+	const Time max_accumulator = time_step * static_cast<Int64>(max_steps_per_frame);
 
 	while (window_.isOpen())
 	{
+		accumulator += clock.restart();
+
+		if (accumulator > max_accumulator)
+		{
+			times_.droppedSteps += (accumulator - max_accumulator).asMicroseconds() / time_step.asMicroseconds();
+			accumulator = max_accumulator;
+		}
+
+		phase_clock.restart();
 		processEvents();
-		update(clock.restart());
-		render();
+		times_.events += phase_clock.restart();
+
+		while (accumulator >= time_step)
+		{
+			update(time_step);
+			accumulator -= time_step;
+			++times_.steps;
+		}
+
+		times_.update += phase_clock.restart();
+
+		render(accumulator / time_step);
+		times_.render += phase_clock.restart();
+		++times_.frames;
+	}
+
+	cout << fixed << setprecision(3)
+	     << "Frames: " << times_.frames << ", steps: " << times_.steps
+	     << ", dropped steps: " << times_.droppedSteps << endl
+	     << "Per frame: events " << per_frame_ms(times_.events, times_.frames) << " ms, update "
+	     << per_frame_ms(times_.update, times_.frames) << " ms, render "
+	     << per_frame_ms(times_.render, times_.frames) << " ms" << endl
+	     << "Per frame: " << per_frame(times_.sprites, times_.frames) << " sprites in "
+	     << per_frame(batch_.drawCalls(), times_.frames) << " draw calls" << endl;
+
+	if (!recordingFile_.empty())
+	{
+		recording_.steps = simulation_.steps();
+		recording_.checksum = simulation_.checksum();
+
+		if (recording_.saveToFile(recordingFile_))
+			cout << "Recorded " << recording_.steps << " steps to " << recordingFile_ << endl;
+		else
+			cout << "ERROR: Could not write file " << recordingFile_ << endl;
 	}
 }
\ No newline at end of file
@@ -0,0 +1,81 @@
+// Spaceship Game
+// InputRecording.cpp
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Source file for the InputRecording class.
+
+#include "InputRecording.h"
+
+#include <fstream>
+#include <sstream>
+
+InputRecording::InputRecording()
+	: seed(0u), steps(0u), checksum(0u) {}
+
+bool InputRecording::saveToFile(const string& filename) const
+{
+	ofstream file(filename);
+
+	if (!file)
+		return false;
+
+	file << "seed " << seed << '\n'
+	     << "steps " << steps << '\n'
+	     << "checksum " << hex << checksum << dec << '\n';
+
+	for (const KeyEvent& e : events)
+		file << "key " << e.step << ' ' << static_cast<int>(e.key) << ' ' << (e.pressed ? 1 : 0) << '\n';
+
+	return static_cast<bool>(file);
+}
+
+bool InputRecording::loadFromFile(const string& filename)
+{
+	ifstream file(filename);
+
+	if (!file)
+		return false;
+
+	seed = 0u;
+	steps = 0u;
+	checksum = 0u;
+	events.clear();
+
+	string line;
+
+	while (getline(file, line))
+	{
+		stringstream ss(line);
+		string tag;
+
+		if (!(ss >> tag))
+			continue;
+
+		if (tag == "seed")
+			ss >> seed;
+		else if (tag == "steps")
+			ss >> steps;
+		else if (tag == "checksum")
+			ss >> hex >> checksum;
+		else if (tag == "key")
+		{
+			KeyEvent e;
+			int key, pressed;
+
+			if (!(ss >> e.step >> key >> pressed))
+				return false;
+
+			e.key = static_cast<Keyboard::Key>(key);
+			e.pressed = pressed != 0;
+			events.push_back(e);
+		}
+		else
+			return false;
+
+		if (ss.fail())
+			return false;
+	}
+
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+// Spaceship Game
+// Motion.cpp
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-17
+// Source file for the batch motion kernels.
+
+#include "Motion.h"
+
+#if defined(__AVX__)
+	#define SPACESHIP_AVX
+	#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define SPACESHIP_SSE
+	#include <emmintrin.h>
+#endif
+
+// Keep the compiler from fusing pos + vel * dt into one multiply-add, which
+// rounds once instead of twice. GCC does this to the intrinsics below as well.
+SFML_VECTORMATH_CONTRACT_OFF
+
+void integrate_clamp_scalar(float* pos, const float* vel, const float* size, size_t n,
+                            float dt, float lower, float upper)
+{
+	for (size_t i = 0; i < n; ++i)
+	{
+		float p = pos[i] + vel[i] * dt;
+		pos[i] = min(max(p, lower), upper - size[i]);
+	}
+}
+
+void integrate_clamp(float* pos, const float* vel, const float* size, size_t n,
+                     float dt, float lower, float upper)
+{
+	size_t i = 0;
+
+	#if defined(SPACESHIP_AVX)
+
+	__m256 dt8 = _mm256_set1_ps(dt);
+	__m256 lower8 = _mm256_set1_ps(lower);
+	__m256 upper8 = _mm256_set1_ps(upper);
+
+	for (; i + 8u <= n; i += 8u)
+	{
+		__m256 p = _mm256_loadu_ps(pos + i);
+		__m256 v = _mm256_loadu_ps(vel + i);
+		__m256 s = _mm256_loadu_ps(size + i);
+
+		// Multiply and add separately, as the scalar version does,
+		// rather than with a fused multiply-add that rounds differently.
+		p = _mm256_add_ps(p, _mm256_mul_ps(v, dt8));
+		p = _mm256_min_ps(_mm256_max_ps(p, lower8), _mm256_sub_ps(upper8, s));
+		_mm256_storeu_ps(pos + i, p);
+	}
+
+	#elif defined(SPACESHIP_SSE)
+
+	__m128 dt4 = _mm_set1_ps(dt);
+	__m128 lower4 = _mm_set1_ps(lower);
+	__m128 upper4 = _mm_set1_ps(upper);
+
+	for (; i + 4u <= n; i += 4u)
+	{
+		__m128 p = _mm_loadu_ps(pos + i);
+		__m128 v = _mm_loadu_ps(vel + i);
+		__m128 s = _mm_loadu_ps(size + i);
+
+		p = _mm_add_ps(p, _mm_mul_ps(v, dt4));
+		p = _mm_min_ps(_mm_max_ps(p, lower4), _mm_sub_ps(upper4, s));
+		_mm_storeu_ps(pos + i, p);
+	}
+
+	#endif
+
+	// The remaining positions that do not fill a whole register.
+	integrate_clamp_scalar(pos + i, vel + i, size + i, n - i, dt, lower, upper);
+}
+
+SFML_VECTORMATH_CONTRACT_RESTORE
+
+const char* integrate_clamp_isa()
+{
+	#if defined(SPACESHIP_AVX)
+	return "AVX";
+	#elif defined(SPACESHIP_SSE)
+	return "SSE";
+	#else
+	return "scalar";
+	#endif
+}
\ No newline at end of file
@@ -0,0 +1,189 @@
+// Spaceship Game
+// Simulation.cpp
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-17
+// Source file for the Simulation class.
+
+#include "Simulation.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+// Steps must round the same way on every build, so keep the compiler
+// from fusing the multiplies and adds below into multiply-adds.
+SFML_VECTORMATH_CONTRACT_OFF
+
+const float player_speed = 400.f;
+const float enemy_speed = 150.f;
+const float projectile_speed = 600.f;
+const Time fire_interval = milliseconds(150);
+
+// Size of the sprites in the textures.
+const IntRect ship_rect(0, 0, 32, 32);
+const IntRect projectile_rect(0, 0, 4, 12);
+
+// Cells a little larger than a ship, so most ships touch at most four cells.
+const float grid_cell_size = 48.f;
+
+const FloatRect window_bounds(0.f, 0.f, static_cast<float>(window_width), static_cast<float>(window_height));
+
+bool Controls::setKey(Keyboard::Key key, bool is_pressed)
+{
+	switch (key)
+	{
+		case Keyboard::Key::W:
+			up = is_pressed;
+			return true;
+		case Keyboard::Key::A:
+			left = is_pressed;
+			return true;
+		case Keyboard::Key::S:
+			down = is_pressed;
+			return true;
+		case Keyboard::Key::D:
+			right = is_pressed;
+			return true;
+		case Keyboard::Key::Space:
+			fire = is_pressed;
+			return true;
+		default:
+			return false;
+	}
+}
+
+void Simulation::checkCollisions()
+{
+	enemyGrid_.build(enemies);
+	hits_.clear();
+
+	// Enemies that ram the player are destroyed.
+	enemyGrid_.query(FloatRect(playerPos.x, playerPos.y, playerSize.x, playerSize.y), hits_);
+
+	// Walk backwards so the projectile moved into a freed row was already checked.
+	for (size_t i = projectiles.size(); i-- > 0u;)
+	{
+		size_t before = hits_.size();
+		FloatRect box(projectiles.xPos[i], projectiles.yPos[i], projectiles.width[i], projectiles.height[i]);
+		enemyGrid_.query(box, hits_);
+
+		if (hits_.size() > before)
+			projectiles.destroy(i);
+	}
+
+	// Destroy from the highest index down, so that every index in hits_
+	// still names the same enemy when its turn comes.
+	sort(hits_.begin(), hits_.end(), greater<uint32_t>());
+	hits_.erase(unique(hits_.begin(), hits_.end()), hits_.end());
+
+	for (uint32_t i : hits_)
+		enemies.destroy(i);
+}
+
+Simulation::Simulation(uint32_t seed)
+	: enemyGrid_(window_bounds, grid_cell_size),
+	  fireCooldown_(Time::Zero),
+	  rng_(seed),
+	  steps_(0u),
+	  playerPos(window_width / 2.f, window_height / 2.f),
+	  playerPrev(playerPos),
+	  playerVel(0.f, 0.f),
+	  playerSize(static_cast<float>(ship_rect.width), static_cast<float>(ship_rect.height))
+{
+	projectiles.addSprite(nullptr, projectile_rect);
+	enemies.addSprite(nullptr, ship_rect);
+
+	float x_range = window_width - static_cast<float>(ship_rect.width);
+	float y_range = window_height - static_cast<float>(ship_rect.height);
+
+	enemies.reserve(ENEMY_COUNT);
+
+	for (uint32_t i = 0; i < ENEMY_COUNT; ++i)
+	{
+		float x = random_unit(rng_) * x_range;
+		float y = random_unit(rng_) * y_range;
+		enemies.create(0u, x, y);
+	}
+}
+
+void Simulation::step(const Controls& controls, Time dt)
+{
+	float s = dt.asSeconds();
+
+	playerPrev = playerPos;
+	enemies.savePositions();
+	projectiles.savePositions();
+
+	playerVel = Vector2f(0.f, 0.f);
+
+	if (controls.up)
+		playerVel.y -= player_speed;
+	if (controls.left)
+		playerVel.x -= player_speed;
+	if (controls.down)
+		playerVel.y += player_speed;
+	if (controls.right)
+		playerVel.x += player_speed;
+
+	playerPos.x += playerVel.x * s;
+	playerPos.y += playerVel.y * s;
+	clamp(playerPos.x, 0.f, window_width - playerSize.x);
+	clamp(playerPos.y, 0.f, window_height - playerSize.y);
+
+	enemies.steer(0u, enemies.size(), enemy_speed, rng_);
+	enemies.move(dt, window_bounds);
+
+	fireCooldown_ -= dt;
+
+	if (controls.fire && fireCooldown_ <= Time::Zero)
+	{
+		float x = playerPos.x + (playerSize.x - projectile_rect.width) / 2.f;
+		float y = playerPos.y - projectile_rect.height;
+		size_t i = projectiles.create(0u, x, y);
+		projectiles.yVel[i] = -projectile_speed;
+		fireCooldown_ = fire_interval;
+	}
+
+	projectiles.integrate(dt);
+	projectiles.destroyOutside(window_bounds);
+
+	checkCollisions();
+	++steps_;
+}
+
+uint64_t Simulation::steps() const
+{
+	return steps_;
+}
+
+uint64_t Simulation::checksum() const
+{
+	uint64_t hash = 14695981039346656037u;
+
+	auto mix = [&hash](float value)
+	{
+		uint32_t bits;
+		memcpy(&bits, &value, sizeof(bits));
+		hash = (hash ^ bits) * 1099511628211u;
+	};
+
+	mix(playerPos.x);
+	mix(playerPos.y);
+
+	for (size_t i = 0; i < enemies.size(); ++i)
+	{
+		mix(enemies.xPos[i]);
+		mix(enemies.yPos[i]);
+	}
+
+	for (size_t i = 0; i < projectiles.size(); ++i)
+	{
+		mix(projectiles.xPos[i]);
+		mix(projectiles.yPos[i]);
+	}
+
+	return hash;
+}
+
+SFML_VECTORMATH_CONTRACT_RESTORE
\ No newline at end of file
@@ -0,0 +1,137 @@
+// Spaceship Game
+// SpatialHash.cpp
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-16
+// Source file for the SpatialHash class.
+
+#include "SpatialHash.h"
+
+#include <cmath>
+
+uint32_t SpatialHash::columnOf(float x) const
+{
+	float c = floor((x - bounds_.left) / cellSize_);
+	return static_cast<uint32_t>(min(max(c, 0.f), static_cast<float>(columns_ - 1u)));
+}
+
+uint32_t SpatialHash::rowOf(float y) const
+{
+	float r = floor((y - bounds_.top) / cellSize_);
+	return static_cast<uint32_t>(min(max(r, 0.f), static_cast<float>(rows_ - 1u)));
+}
+
+SpatialHash::SpatialHash(const FloatRect& bounds, float cell_size)
+	: bounds_(bounds), cellSize_(cell_size), maxWidth_(0.f), maxHeight_(0.f)
+{
+	if (cell_size <= 0.f)
+		throw invalid_argument("ERROR: SpatialHash cell size must be positive");
+
+	columns_ = max(static_cast<uint32_t>(ceil(bounds.width / cell_size)), 1u);
+	rows_ = max(static_cast<uint32_t>(ceil(bounds.height / cell_size)), 1u);
+	cellStart_.assign(static_cast<size_t>(columns_) * rows_ + 1u, 0u);
+}
+
+void SpatialHash::build(const EntityStore& store)
+{
+	size_t n = store.size();
+	size_t cells = cellStart_.size() - 1u;
+
+	cellOf_.resize(n);
+	index_.resize(n);
+	left_.resize(n);
+	top_.resize(n);
+	right_.resize(n);
+	bottom_.resize(n);
+	fill(cellStart_.begin(), cellStart_.end(), 0u);
+
+	maxWidth_ = 0.f;
+	maxHeight_ = 0.f;
+
+	// Count the entities of every cell.
+	for (size_t i = 0; i < n; ++i)
+	{
+		uint32_t cell = rowOf(store.yPos[i]) * columns_ + columnOf(store.xPos[i]);
+		cellOf_[i] = cell;
+		++cellStart_[cell + 1u];
+
+		maxWidth_ = max(maxWidth_, store.width[i]);
+		maxHeight_ = max(maxHeight_, store.height[i]);
+	}
+
+	// Turn the counts into the first slot of every cell.
+	for (size_t c = 0; c < cells; ++c)
+		cellStart_[c + 1u] += cellStart_[c];
+
+	// Fill the slots of every cell in entity order. This moves each
+	// cell's start to the start of the next cell, so shift them back after.
+	for (size_t i = 0; i < n; ++i)
+	{
+		uint32_t slot = cellStart_[cellOf_[i]]++;
+		index_[slot] = static_cast<uint32_t>(i);
+		left_[slot] = store.xPos[i];
+		top_[slot] = store.yPos[i];
+		right_[slot] = store.xPos[i] + store.width[i];
+		bottom_[slot] = store.yPos[i] + store.height[i];
+	}
+
+	for (size_t c = cells; c > 0u; --c)
+		cellStart_[c] = cellStart_[c - 1u];
+
+	cellStart_[0] = 0u;
+}
+
+void SpatialHash::query(const FloatRect& area, vector<uint32_t>& result) const
+{
+	float right = area.left + area.width;
+	float bottom = area.top + area.height;
+
+	uint32_t c0 = columnOf(area.left - maxWidth_);
+	uint32_t c1 = columnOf(right);
+	uint32_t r0 = rowOf(area.top - maxHeight_);
+	uint32_t r1 = rowOf(bottom);
+
+	for (uint32_t r = r0; r <= r1; ++r)
+	{
+		// The cells of a row are adjacent, so a row is one run of slots.
+		uint32_t first = cellStart_[r * columns_ + c0];
+		uint32_t last = cellStart_[r * columns_ + c1 + 1u];
+
+		for (uint32_t s = first; s < last; ++s)
+		{
+			if (left_[s] < right && area.left < right_[s] && top_[s] < bottom && area.top < bottom_[s])
+				result.push_back(index_[s]);
+		}
+	}
+}
+
+void SpatialHash::queryRadius(const Vector2f& center, float radius, vector<uint32_t>& result) const
+{
+	float r2 = radius * radius;
+
+	uint32_t c0 = columnOf(center.x - radius - maxWidth_);
+	uint32_t c1 = columnOf(center.x + radius);
+	uint32_t r0 = rowOf(center.y - radius - maxHeight_);
+	uint32_t r1 = rowOf(center.y + radius);
+
+	for (uint32_t r = r0; r <= r1; ++r)
+	{
+		uint32_t first = cellStart_[r * columns_ + c0];
+		uint32_t last = cellStart_[r * columns_ + c1 + 1u];
+
+		for (uint32_t s = first; s < last; ++s)
+		{
+			// Distance from the center to the nearest point of the box.
+			float dx = max(max(left_[s] - center.x, center.x - right_[s]), 0.f);
+			float dy = max(max(top_[s] - center.y, center.y - bottom_[s]), 0.f);
+
+			if (dx * dx + dy * dy <= r2)
+				result.push_back(index_[s]);
+		}
+	}
+}
+
+size_t SpatialHash::size() const
+{
+	return index_.size();
+}
\ No newline at end of file
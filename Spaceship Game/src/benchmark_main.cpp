@@ -0,0 +1,859 @@
+// Spaceship Game
+// benchmark_main.cpp
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-17
+// Main file of the headless Benchmark target.
+//
+// Usage: Benchmark [counts...]
+//        Benchmark --soak <steps> [--seed <n>]
+//        Benchmark --replay <file>
+//   counts             Entity counts to measure (default: 1000 10000 100000)
+//   --soak <steps>     Run the game's Simulation headless for the given number
+//                      of fixed steps, as fast as possible, with scripted
+//                      controls, and report how much faster than real time it ran
+//   --seed <n>         Seed of the soak run (default: 1)
+//   --replay <file>    Replay a game recorded with the game's --record option
+//                      headless, as fast as possible, and check that it ends
+//                      in the same state
+//
+// Soak runs and replays report percentiles of the time taken by one step.
+// Times one frame of motion for every entity three ways: one Player object
+// at a time, the portable scalar kernel over the EntityStore arrays, and
+// the SIMD kernel over the same arrays.
+//
+// Then times one frame of collision checks, a player and a fixed number of
+// projectiles against every enemy, both all-pairs and with a SpatialHash.
+// The world grows with the enemy count so that the density stays the same.
+//
+// Then times building one frame's SpriteBatch, enemies and projectiles from
+// their EntityStores and the player's Sprite, against updating one Sprite
+// per entity, and counts the draw calls each way. The batch is also built
+// with the two textures interleaved, which breaks it into a run per sprite.
+//
+// Then records one Sprite draw per entity, in shuffled order, into a
+// RenderQueue, and flushes it in submission order and sorted into a
+// stand-in target that counts the calls instead of making them, so that
+// no GPU is needed.
+//
+// Then records one frame's SpriteBatch into a RecordingTarget, once only
+// recording it and once also rasterising it on the CPU, and checks the
+// rasterised frame against the same sprites drawn one at a time, and
+// that semi-transparent sprites at whole pixel positions blend every
+// pixel they cover exactly once.
+//
+// Then times rendering a SpriteBatch with the SoftwareRasterizer on one
+// thread and on every thread, and checks that both give the same image.
+//
+// Exits with 1 if the kernels, the collision checks or the batched quads
+// disagree, if sorting changes the order of any texture's draws, if a
+// rasterised batch differs from its sprites, blends a pixel twice or
+// depends on the number of threads, or if a replay does not match its
+// recording.
+
+#include "InputRecording.h"
+#include "Motion.h"
+#include "Player.h"
+#include "Simulation.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <vector>
+
+// Roughly how many entity updates each measurement performs.
+const uint64_t updates_per_test = 50000000u;
+
+const Time frame_time = seconds(1.f / 60.f);
+
+// Results are written here so that the work cannot be optimised away.
+volatile float sink;
+
+// Calls update frames times, after one untimed call to fault in the memory,
+// and returns the average time of one call in nanoseconds.
+template <typename Function>
+double measure(uint64_t frames, Function update)
+{
+	update();
+
+	Clock clock;
+
+	for (uint64_t f = 0; f < frames; ++f)
+		update();
+
+	return clock.getElapsedTime().asMicroseconds() * 1000.0 / static_cast<double>(frames);
+}
+
+// Returns false if the SIMD and scalar kernels disagree.
+bool benchmark_motion(const vector<size_t>& counts)
+{
+	Texture texture;
+	default_random_engine engine(12345u);
+	uniform_real_distribution<float> x_dist(0.f, window_width - 32.f);
+	uniform_real_distribution<float> y_dist(0.f, window_height - 32.f);
+	uniform_real_distribution<float> v_dist(-400.f, 400.f);
+
+	float dt = frame_time.asSeconds();
+	float right = static_cast<float>(window_width);
+	float bottom = static_cast<float>(window_height);
+	bool mismatch = false;
+
+	cout << "SIMD kernel: " << integrate_clamp_isa() << endl;
+	cout << setw(10) << "entities" << setw(14) << "per-object" << setw(14) << "scalar SoA"
+	     << setw(14) << "SIMD SoA" << setw(10) << "speedup" << "   (ns per entity)" << endl;
+
+	for (size_t count : counts)
+	{
+		vector<Player> players;
+		vector<float> x_pos(count), y_pos(count), x_vel(count), y_vel(count);
+		vector<float> size(count, 32.f);
+
+		players.reserve(count);
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			x_pos[i] = x_dist(engine);
+			y_pos[i] = y_dist(engine);
+			x_vel[i] = v_dist(engine);
+			y_vel[i] = v_dist(engine);
+
+			players.emplace_back(&texture, x_pos[i], y_pos[i]);
+			players.back().velocity = Vector2f(x_vel[i], y_vel[i]);
+		}
+
+		vector<float> x_simd = x_pos, y_simd = y_pos;
+		uint64_t frames = max<uint64_t>(updates_per_test / count, 10u);
+
+		double object_ns = measure(frames, [&]()
+		{
+			for (Player& player : players)
+				player.update(frame_time);
+		}) / count;
+
+		double scalar_ns = measure(frames, [&]()
+		{
+			integrate_clamp_scalar(x_pos.data(), x_vel.data(), size.data(), count, dt, 0.f, right);
+			integrate_clamp_scalar(y_pos.data(), y_vel.data(), size.data(), count, dt, 0.f, bottom);
+		}) / count;
+
+		double simd_ns = measure(frames, [&]()
+		{
+			integrate_clamp(x_simd.data(), x_vel.data(), size.data(), count, dt, 0.f, right);
+			integrate_clamp(y_simd.data(), y_vel.data(), size.data(), count, dt, 0.f, bottom);
+		}) / count;
+
+		// Both kernels ran the same number of frames from the same start.
+		if (x_pos != x_simd || y_pos != y_simd)
+			mismatch = true;
+
+		cout << fixed << setprecision(3)
+		     << setw(10) << count << setw(14) << object_ns << setw(14) << scalar_ns
+		     << setw(14) << simd_ns << setw(9) << setprecision(1) << object_ns / simd_ns << "x" << endl;
+	}
+
+	if (mismatch)
+		cout << "ERROR: SIMD and scalar kernels disagree" << endl;
+
+	return !mismatch;
+}
+
+// Returns false if the grid and all-pairs checks find different hits.
+bool benchmark_collision(const vector<size_t>& counts)
+{
+	const size_t projectile_count = 1000u;
+	const float cell_size = 48.f;
+
+	Texture texture;
+	default_random_engine engine(12345u);
+	bool mismatch = false;
+
+	cout << endl << projectile_count << " projectiles and a player against every enemy" << endl;
+	cout << setw(10) << "enemies" << setw(14) << "all-pairs" << setw(14) << "grid build"
+	     << setw(14) << "grid query" << setw(10) << "speedup" << "   (us per frame)" << endl;
+
+	for (size_t count : counts)
+	{
+		// Keep about one enemy per 64 by 64 pixels.
+		float side = 64.f * sqrt(static_cast<float>(count));
+		FloatRect world(0.f, 0.f, side, side);
+		uniform_real_distribution<float> dist(0.f, side - 32.f);
+
+		EntityStore enemies;
+		uint32_t sprite = enemies.addSprite(&texture, IntRect(0, 0, 32, 32));
+		enemies.reserve(count);
+
+		for (size_t i = 0; i < count; ++i)
+			enemies.create(sprite, dist(engine), dist(engine));
+
+		vector<FloatRect> boxes;
+		boxes.emplace_back(dist(engine), dist(engine), 32.f, 32.f);
+
+		for (size_t i = 0; i < projectile_count; ++i)
+			boxes.emplace_back(dist(engine), dist(engine), 4.f, 12.f);
+
+		vector<uint32_t> pair_hits, grid_hits;
+		SpatialHash grid(world, cell_size);
+
+		double pairs_us = measure(10u, [&]()
+		{
+			pair_hits.clear();
+
+			for (const FloatRect& box : boxes)
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					if (box.intersects(FloatRect(enemies.xPos[i], enemies.yPos[i], enemies.width[i], enemies.height[i])))
+						pair_hits.push_back(static_cast<uint32_t>(i));
+				}
+			}
+		}) / 1000.0;
+
+		double build_us = measure(100u, [&]()
+		{
+			grid.build(enemies);
+		}) / 1000.0;
+
+		double query_us = measure(100u, [&]()
+		{
+			grid_hits.clear();
+
+			for (const FloatRect& box : boxes)
+				grid.query(box, grid_hits);
+		}) / 1000.0;
+
+		sort(pair_hits.begin(), pair_hits.end());
+		sort(grid_hits.begin(), grid_hits.end());
+
+		if (pair_hits != grid_hits)
+			mismatch = true;
+
+		cout << fixed << setprecision(1)
+		     << setw(10) << count << setw(14) << pairs_us << setw(14) << build_us
+		     << setw(14) << query_us << setw(9) << pairs_us / (build_us + query_us) << "x" << endl;
+	}
+
+	if (mismatch)
+		cout << "ERROR: grid and all-pairs collision checks disagree" << endl;
+
+	return !mismatch;
+}
+
+// Seed of the random positions in every benchmark scene.
+const uint32_t scene_seed = 12345u;
+
+// Returns an image of the given size filled with color.
+Image make_filled_image(unsigned int width, unsigned int height, const Color& color)
+{
+	Image image;
+	image.create(width, height, color);
+	return image;
+}
+
+// The textures of the benchmark scenes. They are never loaded, as no benchmark
+// draws to a real target; the images stand in for them on the targets that
+// rasterise on the CPU.
+const Texture enemy_texture;
+const Texture projectile_texture;
+const Image enemy_image = make_filled_image(32u, 32u, Color(200, 60, 60, 200));
+const Image projectile_image = make_filled_image(4u, 12u, Color(250, 250, 120));
+
+// Returns enemy_count enemy Sprites followed by projectile_count projectile
+// Sprites, at random whole pixel positions within the window. Whole pixels,
+// so that positions transformed on the CPU, as a SpriteBatch does, come out
+// exactly as those transformed by the target, and cover the same pixels.
+vector<Sprite> make_benchmark_scene(size_t enemy_count, size_t projectile_count)
+{
+	default_random_engine engine(scene_seed);
+	uniform_real_distribution<float> x_dist(0.f, window_width - 32.f);
+	uniform_real_distribution<float> y_dist(0.f, window_height - 32.f);
+	vector<Sprite> sprites;
+	sprites.reserve(enemy_count + projectile_count);
+
+	for (size_t i = 0; i < enemy_count; ++i)
+		sprites.emplace_back(enemy_texture, IntRect(0, 0, 32, 32));
+
+	for (size_t i = 0; i < projectile_count; ++i)
+		sprites.emplace_back(projectile_texture, IntRect(0, 0, 4, 12));
+
+	for (Sprite& sprite : sprites)
+		sprite.setPosition(floor(x_dist(engine)), floor(y_dist(engine)));
+
+	return sprites;
+}
+
+// Returns false if a batched quad is not where its entity is.
+bool benchmark_batching(const vector<size_t>& counts)
+{
+	const size_t projectile_count = 1000u;
+
+	bool mismatch = false;
+
+	cout << endl << "Drawing every enemy, " << projectile_count << " projectiles and a player" << endl;
+	cout << setw(10) << "enemies" << setw(14) << "per-sprite" << setw(8) << "calls" << setw(14) << "batched"
+	     << setw(8) << "calls" << setw(14) << "interleaved" << setw(8) << "calls" << "   (ns per sprite)" << endl;
+
+	for (size_t count : counts)
+	{
+		// The per-object way: a Sprite per entity, moved into place and
+		// drawn on its own, each draw computing the Sprite's transform.
+		vector<Sprite> sprites = make_benchmark_scene(count, projectile_count);
+
+		EntityStore enemies;
+		EntityStore projectiles;
+		enemies.addSprite(&enemy_texture, IntRect(0, 0, 32, 32));
+		projectiles.addSprite(&projectile_texture, IntRect(0, 0, 4, 12));
+		enemies.reserve(count);
+		projectiles.reserve(projectile_count);
+
+		for (size_t i = 0; i < count; ++i)
+			enemies.create(0u, sprites[i].getPosition().x, sprites[i].getPosition().y);
+
+		for (size_t i = 0; i < projectile_count; ++i)
+			projectiles.create(0u, sprites[count + i].getPosition().x, sprites[count + i].getPosition().y);
+
+		Sprite player(enemy_texture, IntRect(0, 0, 32, 32));
+		player.setPosition(window_width / 2.f, window_height / 2.f);
+		sprites.push_back(player);
+
+		size_t total = sprites.size();
+		uint64_t frames = max<uint64_t>(updates_per_test / 10u / total, 10u);
+		float checksum = 0.f;
+
+		double sprite_ns = measure(frames, [&]()
+		{
+			for (size_t i = 0; i < count; ++i)
+				sprites[i].setPosition(enemies.xPos[i], enemies.yPos[i]);
+
+			for (size_t i = 0; i < projectile_count; ++i)
+				sprites[count + i].setPosition(projectiles.xPos[i], projectiles.yPos[i]);
+
+			for (const Sprite& sprite : sprites)
+				checksum += sprite.getTransform().getMatrix()[12];
+		}) / total;
+
+		SpriteBatch batch;
+		batch.reserve(total);
+
+		double batch_ns = measure(frames, [&]()
+		{
+			batch.clear();
+			enemies.draw(batch);
+			projectiles.draw(batch);
+			batch.add(player);
+		}) / total;
+
+		size_t batch_calls = batch.batchCount();
+
+		// Every enemy quad starts at its entity's position, in order.
+		const vector<Vertex>& vertices = batch.vertices();
+
+		if (batch.spriteCount() != total || batch_calls != 3u)
+			mismatch = true;
+
+		for (size_t i = 0; i < count && !mismatch; ++i)
+		{
+			if (vertices[i * 4u].position != Vector2f(enemies.xPos[i], enemies.yPos[i]))
+				mismatch = true;
+		}
+
+		// Alternating textures, as happens when entities are drawn in
+		// whatever order they are stored without grouping them by texture.
+		double interleaved_ns = measure(frames, [&]()
+		{
+			batch.clear();
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				batch.add(enemy_texture, IntRect(0, 0, 32, 32), Vector2f(enemies.xPos[i], enemies.yPos[i]));
+
+				if (i < projectile_count)
+					batch.add(projectile_texture, IntRect(0, 0, 4, 12), Vector2f(projectiles.xPos[i], projectiles.yPos[i]));
+			}
+
+			batch.add(player);
+		}) / total;
+
+		size_t interleaved_calls = batch.batchCount();
+		sink = checksum;
+
+		cout << fixed << setprecision(2)
+		     << setw(10) << count << setw(14) << sprite_ns << setw(8) << total
+		     << setw(14) << batch_ns << setw(8) << batch_calls
+		     << setw(14) << interleaved_ns << setw(8) << interleaved_calls << endl;
+	}
+
+	if (mismatch)
+		cout << "ERROR: batched quads are not where their entities are" << endl;
+
+	return !mismatch;
+}
+
+// Stands in for a RenderTarget: counts the draws flushed into it, and
+// hashes the positions each texture is drawn at, in the order they come.
+struct CountingTarget
+{
+	size_t calls = 0u;
+	size_t vertices = 0u;
+	map<const Texture*, double> hashes;
+
+	void draw(const Vertex* v, size_t count, PrimitiveType, const RenderStates& states)
+	{
+		const float* m = states.transform.getMatrix();
+		double& hash = hashes[states.texture];
+
+		for (size_t i = 0; i < count; ++i)
+			hash = hash * 0.999 + (m[0] * v[i].position.x + m[4] * v[i].position.y + m[12]);
+
+		++calls;
+		vertices += count;
+	}
+};
+
+// Returns false if sorting changes what any texture draws, or in which order,
+// or if draws with a NaN depth are not flushed after all the others.
+bool benchmark_render_queue(const vector<size_t>& counts)
+{
+	const size_t projectile_count = 1000u;
+
+	bool mismatch = false;
+
+	cout << endl << "One Sprite draw per entity through a RenderQueue, shuffled" << endl;
+	cout << setw(10) << "sprites" << setw(10) << "order" << setw(14) << "ns per draw" << setw(12) << "calls"
+	     << setw(12) << "changes" << setw(12) << "avoided" << endl;
+
+	for (size_t count : counts)
+	{
+		vector<Sprite> sprites = make_benchmark_scene(count, projectile_count);
+		shuffle(sprites.begin(), sprites.end(), default_random_engine(scene_seed));
+
+		uint64_t frames = max<uint64_t>(updates_per_test / 20u / sprites.size(), 10u);
+		CountingTarget targets[2];
+
+		for (int sorted = 0; sorted < 2; ++sorted)
+		{
+			RenderQueue queue(sorted ? RenderQueue::Sorted : RenderQueue::Submission);
+			CountingTarget& target = targets[sorted];
+
+			double draw_ns = measure(frames, [&]()
+			{
+				target = CountingTarget();
+
+				for (const Sprite& sprite : sprites)
+					queue.draw(sprite);
+
+				queue.resetStatistics();
+				queue.flush(target);
+			}) / sprites.size();
+
+			const RenderQueue::Statistics& stats = queue.statistics();
+
+			cout << fixed << setprecision(2)
+			     << setw(10) << sprites.size() << setw(10) << (sorted ? "sorted" : "submitted") << setw(14) << draw_ns
+			     << setw(12) << stats.drawCalls << setw(12) << stats.flushed.total() << setw(12) << stats.avoided() << endl;
+		}
+
+		if (targets[0].vertices != targets[1].vertices || targets[0].hashes != targets[1].hashes)
+			mismatch = true;
+	}
+
+	if (mismatch)
+		cout << "ERROR: sorted draws differ from submitted draws" << endl;
+
+	// Draws with a NaN depth go after every other draw, in submission order.
+	const float nan = numeric_limits<float>::quiet_NaN();
+	const float depths[] = { 3.f, nan, 1.f, nan, 2.f, -1.f, nan, 0.f };
+	const size_t expected_order[] = { 5, 7, 2, 4, 0, 1, 3, 6 };
+
+	RenderQueue sorted_queue(RenderQueue::Sorted);
+	RenderQueue expected_queue(RenderQueue::Submission);
+	CountingTarget sorted_target;
+	CountingTarget expected_target;
+	Sprite sprite(enemy_texture, IntRect(0, 0, 32, 32));
+
+	for (size_t i = 0; i < size(depths); ++i)
+	{
+		sprite.setPosition(static_cast<float>(i), 0.f);
+		sorted_queue.draw(sprite, RenderStates::Default, depths[i]);
+	}
+
+	for (size_t i : expected_order)
+	{
+		sprite.setPosition(static_cast<float>(i), 0.f);
+		expected_queue.draw(sprite);
+	}
+
+	sorted_queue.flush(sorted_target);
+	expected_queue.flush(expected_target);
+
+	if (sorted_target.hashes != expected_target.hashes)
+	{
+		cout << "ERROR: draws with a NaN depth are not flushed last" << endl;
+		mismatch = true;
+	}
+
+	return !mismatch;
+}
+
+// Returns false if a rasterised batch differs from the same sprites
+// rasterised one draw at a time, or is not recorded as one draw per run,
+// or if a sprite at a whole pixel position blends a pixel twice.
+bool benchmark_recording(const vector<size_t>& counts)
+{
+	const size_t projectile_count = 1000u;
+
+	size_t differing_pixels = 0u;
+	bool mismatch = false;
+
+	cout << endl << "Recording a SpriteBatch into a RecordingTarget, without and with rasterising" << endl;
+	cout << setw(10) << "sprites" << setw(10) << "draws" << setw(14) << "recorded" << setw(14) << "rasterised"
+	     << "   (ns per sprite)" << endl;
+
+	for (size_t count : counts)
+	{
+		vector<Sprite> sprites = make_benchmark_scene(count, projectile_count);
+
+		SpriteBatch batch;
+		batch.reserve(sprites.size());
+
+		for (const Sprite& sprite : sprites)
+			batch.add(sprite);
+
+		RecordingTarget recorder(window_width, window_height);
+		RecordingTarget rasteriser(window_width, window_height, true);
+		rasteriser.setTextureImage(enemy_texture, &enemy_image);
+		rasteriser.setTextureImage(projectile_texture, &projectile_image);
+
+		double record_ns = measure(max<uint64_t>(updates_per_test / 20u / sprites.size(), 10u), [&]()
+		{
+			recorder.reset();
+			recorder.clear();
+			recorder.draw(batch);
+		}) / sprites.size();
+
+		double raster_ns = measure(max<uint64_t>(updates_per_test / 1000u / sprites.size(), 1u), [&]()
+		{
+			rasteriser.reset();
+			rasteriser.clear();
+			rasteriser.draw(batch);
+			rasteriser.finish();
+		}) / sprites.size();
+
+		cout << fixed << setprecision(2)
+		     << setw(10) << sprites.size() << setw(10) << recorder.drawCount() << setw(14) << record_ns
+		     << setw(14) << raster_ns << endl;
+
+		RecordingTarget reference(window_width, window_height, true);
+		reference.setTextureImage(enemy_texture, &enemy_image);
+		reference.setTextureImage(projectile_texture, &projectile_image);
+		reference.clear();
+
+		for (const Sprite& sprite : sprites)
+			reference.draw(sprite);
+
+		Image batched = rasteriser.capture();
+		Image expected = reference.capture();
+		size_t pixel_count = static_cast<size_t>(window_width) * window_height;
+
+		for (size_t i = 0; i < pixel_count; ++i)
+		{
+			if (!equal(batched.getPixelsPtr() + i * 4u, batched.getPixelsPtr() + i * 4u + 4u, expected.getPixelsPtr() + i * 4u))
+				++differing_pixels;
+		}
+
+		if (recorder.drawCount() != batch.batchCount())
+			mismatch = true;
+	}
+
+	if (differing_pixels != 0u)
+	{
+		cout << "ERROR: the rasterised batch differs from the sprites drawn one at a time in "
+		     << differing_pixels << " pixels" << endl;
+		mismatch = true;
+	}
+	else if (mismatch)
+		cout << "ERROR: the batch was not recorded as one draw per run of sprites" << endl;
+
+	// Semi-transparent sprites at whole pixel positions, drawn through the
+	// default view, must blend every pixel they cover exactly once, along
+	// the diagonal their triangles share too. Each frame places a grid of
+	// them, shifted a little from frame to frame.
+	const uint32_t spacing = 40u;
+	const Color black(0, 0, 0, 255);
+	RecordingTarget placed(window_width, window_height, true);
+	placed.setTextureImage(enemy_texture, &enemy_image);
+	Sprite sprite(enemy_texture, IntRect(0, 0, 32, 32));
+	size_t placements = 0u;
+	size_t wrong_pixels = 0u;
+
+	for (uint32_t frame = 0u; frame < spacing; ++frame)
+	{
+		uint32_t left = frame;
+		uint32_t top = (frame * 17u) % spacing;
+		placed.reset();
+		placed.clear(black);
+
+		for (uint32_t y = top; y + 32u <= window_height; y += spacing)
+		{
+			for (uint32_t x = left; x + 32u <= window_width; x += spacing)
+			{
+				sprite.setPosition(static_cast<float>(x), static_cast<float>(y));
+				placed.draw(sprite);
+				++placements;
+			}
+		}
+
+		Image image = placed.capture();
+		const Uint8* pixels = image.getPixelsPtr();
+		const Uint8* once = pixels + (static_cast<size_t>(top + 2u) * window_width + left + 2u) * 4u;
+		Color blended(once[0], once[1], once[2], once[3]);
+
+		for (uint32_t y = 0u; y < window_height; ++y)
+		{
+			uint32_t sprite_y = y < top ? 0u : top + (y - top) / spacing * spacing;
+			bool covered_y = y >= top && y < sprite_y + 32u && sprite_y + 32u <= window_height;
+
+			for (uint32_t x = 0u; x < window_width; ++x)
+			{
+				uint32_t sprite_x = x < left ? 0u : left + (x - left) / spacing * spacing;
+				bool covered = covered_y && x >= left && x < sprite_x + 32u && sprite_x + 32u <= window_width;
+				const Uint8* pixel = pixels + (static_cast<size_t>(y) * window_width + x) * 4u;
+
+				if (Color(pixel[0], pixel[1], pixel[2], pixel[3]) != (covered ? blended : black))
+					++wrong_pixels;
+			}
+		}
+
+		if (blended == black)
+			++wrong_pixels;
+	}
+
+	cout << placements << " sprites at whole pixels, " << wrong_pixels << " pixels not blended exactly once" << endl;
+
+	if (wrong_pixels != 0u)
+	{
+		cout << "ERROR: a sprite at a whole pixel position blends some pixel other than once" << endl;
+		mismatch = true;
+	}
+
+	return !mismatch;
+}
+
+// Returns false if rendering on every thread differs from rendering on one.
+bool benchmark_software_rasterizer(const vector<size_t>& counts)
+{
+	bool mismatch = false;
+
+	SoftwareRasterizer serial(window_width, window_height, 1u);
+	SoftwareRasterizer parallel(window_width, window_height);
+	serial.setTextureImage(enemy_texture, &enemy_image);
+	parallel.setTextureImage(enemy_texture, &enemy_image);
+
+	cout << endl << "Rendering a SpriteBatch with the SoftwareRasterizer (" << vector_math_isa() << ")" << endl;
+	cout << setw(10) << "sprites" << setw(14) << "1 thread" << setw(14) << parallel.threadCount() << " threads"
+	     << setw(10) << "speedup" << "   (ns per sprite)" << endl;
+
+	for (size_t count : counts)
+	{
+		SpriteBatch batch;
+		batch.reserve(count);
+
+		for (const Sprite& sprite : make_benchmark_scene(count, 0u))
+			batch.add(sprite);
+
+		uint64_t frames = max<uint64_t>(updates_per_test / 1000u / count, 1u);
+		double ns[2];
+		SoftwareRasterizer* rasterizers[2] = { &serial, &parallel };
+
+		for (int i = 0; i < 2; ++i)
+		{
+			SoftwareRasterizer& rasterizer = *rasterizers[i];
+
+			ns[i] = measure(frames, [&]()
+			{
+				rasterizer.clear();
+				batch.drawTo(rasterizer);
+				rasterizer.finish();
+			}) / count;
+		}
+
+		cout << fixed << setprecision(2)
+		     << setw(10) << count << setw(14) << ns[0] << setw(22) << ns[1] << setw(10) << ns[0] / ns[1] << endl;
+
+		Image one = serial.capture();
+		Image all = parallel.capture();
+		size_t bytes = static_cast<size_t>(window_width) * window_height * 4u;
+
+		if (!equal(one.getPixelsPtr(), one.getPixelsPtr() + bytes, all.getPixelsPtr()))
+			mismatch = true;
+	}
+
+	if (mismatch)
+		cout << "ERROR: rendering on every thread differs from rendering on one" << endl;
+
+	return !mismatch;
+}
+
+// Returns the controls of a soak run at the given step: always firing,
+// and sweeping through all eight directions one second at a time.
+Controls soak_controls(uint64_t step)
+{
+	uint64_t direction = (step / 60u) % 8u;
+
+	Controls controls;
+	controls.up = direction == 0u || direction == 1u || direction == 7u;
+	controls.right = direction >= 1u && direction <= 3u;
+	controls.down = direction >= 3u && direction <= 5u;
+	controls.left = direction >= 5u && direction <= 7u;
+	controls.fire = true;
+	return controls;
+}
+
+// Runs one step of the Simulation and adds its time in nanoseconds to step_ns.
+// sf::Clock only counts microseconds, which is longer than most steps take.
+inline void timed_step(Simulation& simulation, const Controls& controls, vector<double>& step_ns)
+{
+	auto start = chrono::steady_clock::now();
+	simulation.step(controls, time_step);
+	auto end = chrono::steady_clock::now();
+
+	step_ns.push_back(chrono::duration<double, nano>(end - start).count());
+}
+
+// Prints the total time of a run of steps, how it compares to real time,
+// and the percentiles of the time taken by one step.
+void print_step_times(vector<double> step_ns)
+{
+	if (step_ns.empty())
+		return;
+
+	double total_ns = 0.0;
+
+	for (double ns : step_ns)
+		total_ns += ns;
+
+	sort(step_ns.begin(), step_ns.end());
+
+	auto percentile = [&step_ns](double p)
+	{
+		size_t i = static_cast<size_t>(p / 100.0 * static_cast<double>(step_ns.size()));
+		return step_ns[min(i, step_ns.size() - 1u)] / 1000.0;
+	};
+
+	Time simulated = time_step * static_cast<Int64>(step_ns.size());
+
+	cout << fixed << setprecision(3)
+	     << "Steps: " << step_ns.size() << " (" << simulated.asSeconds() << " s simulated)" << endl
+	     << "Step time: " << total_ns / 1e9 << " s, "
+	     << total_ns / 1000.0 / static_cast<double>(step_ns.size()) << " us per step, "
+	     << setprecision(1) << simulated.asSeconds() * 1e9 / total_ns << "x real time" << endl
+	     << setprecision(3)
+	     << "Per step: p50 " << percentile(50.0) << " us, p90 " << percentile(90.0)
+	     << " us, p99 " << percentile(99.0) << " us, p99.9 " << percentile(99.9)
+	     << " us, max " << step_ns.back() / 1000.0 << " us" << endl;
+}
+
+void soak(uint64_t steps, uint32_t seed)
+{
+	Simulation simulation(seed);
+	vector<double> step_ns;
+	step_ns.reserve(steps);
+
+	for (uint64_t s = 0; s < steps; ++s)
+		timed_step(simulation, soak_controls(s), step_ns);
+
+	print_step_times(step_ns);
+
+	cout << "Enemies left: " << simulation.enemies.size() << ", projectiles: " << simulation.projectiles.size() << endl
+	     << "State checksum: " << hex << simulation.checksum() << dec << endl;
+}
+
+// Returns false if the recording could not be read or the replay ended
+// in a different state from the recorded game.
+bool replay(const string& filename)
+{
+	InputRecording recording;
+
+	if (!recording.loadFromFile(filename))
+	{
+		cout << "ERROR: Could not read recording " << filename << endl;
+		return false;
+	}
+
+	Simulation simulation(recording.seed);
+	Controls controls;
+	vector<double> step_ns;
+	size_t next_event = 0u;
+
+	step_ns.reserve(recording.steps);
+
+	for (uint64_t s = 0; s < recording.steps; ++s)
+	{
+		while (next_event < recording.events.size() && recording.events[next_event].step <= s)
+		{
+			const KeyEvent& e = recording.events[next_event++];
+			controls.setKey(e.key, e.pressed);
+		}
+
+		timed_step(simulation, controls, step_ns);
+	}
+
+	cout << "Replaying " << filename << ": seed " << recording.seed << ", "
+	     << recording.events.size() << " key events" << endl;
+	print_step_times(step_ns);
+
+	if (simulation.checksum() != recording.checksum)
+	{
+		cout << "ERROR: Replay ended with checksum " << hex << simulation.checksum()
+		     << ", recorded " << recording.checksum << dec << endl;
+		return false;
+	}
+
+	cout << "State checksum: " << hex << simulation.checksum() << dec << " (matches the recording)" << endl;
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	vector<size_t> counts;
+	uint64_t soak_steps = 0u;
+	uint32_t seed = 1u;
+	string replay_file;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		string arg = argv[i];
+
+		if (arg == "--soak" && i + 1 < argc)
+			soak_steps = stoull(argv[++i]);
+		else if (arg == "--seed" && i + 1 < argc)
+			seed = static_cast<uint32_t>(stoul(argv[++i]));
+		else if (arg == "--replay" && i + 1 < argc)
+			replay_file = argv[++i];
+		else
+			counts.push_back(stoul(arg));
+	}
+
+	if (!replay_file.empty())
+		return replay(replay_file) ? 0 : 1;
+
+	if (soak_steps > 0u)
+	{
+		soak(soak_steps, seed);
+		return 0;
+	}
+
+	if (counts.empty())
+		counts = { 1000u, 10000u, 100000u };
+
+	bool motion_ok = benchmark_motion(counts);
+	bool collision_ok = benchmark_collision(counts);
+	bool batching_ok = benchmark_batching(counts);
+	bool queue_ok = benchmark_render_queue(counts);
+	bool recording_ok = benchmark_recording(counts);
+	bool rasterizer_ok = benchmark_software_rasterizer(counts);
+
+	return motion_ok && collision_ok && batching_ok && queue_ok && recording_ok && rasterizer_ok ? 0 : 1;
+}
\ No newline at end of file
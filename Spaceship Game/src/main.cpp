@@ -2,23 +2,169 @@
 // main.cpp
 // Justyn Durnford
 // Created on 2021-05-07
-// Last modified on 2021-05-15
+// Last modified on 2026-10-17
 // Main file.
+//
+// Usage: Spaceship Game [--seed <n>] [--record <file>]
+//   --seed <n>         Seed of the game (default: random)
+//   --record <file>    Record the game to file, to be replayed by the
+//                      Benchmark target with --replay
 
 #include "Define.h"
-#include "Entity.h"
-#include "Player.h"
 #include "Game.h"
 
-int main()
+#include <charconv>
+#include <filesystem>
+
+// The prebaked atlas, written the first time the game runs
+// and again whenever one of the sprite images changes.
+const string atlas_image_file = "spaceship_atlas.png";
+const string atlas_index_file = "spaceship_atlas.txt";
+const string atlas_sources[] = { "player_spaceship.png", "enemy_spaceship.png" };
+
+// Returns true if both atlas files exist and were written after every sprite
+// image. A sprite image that cannot be found does not count against them.
+bool atlas_is_current()
 {
-	if (!player_spaceship_texture.loadFromFile("player_spaceship.png"))
+	error_code error;
+	filesystem::file_time_type image_time = filesystem::last_write_time(atlas_image_file, error);
+
+	if (error)
+		return false;
+
+	filesystem::file_time_type index_time = filesystem::last_write_time(atlas_index_file, error);
+
+	if (error)
+		return false;
+
+	filesystem::file_time_type baked_time = min(image_time, index_time);
+
+	for (const string& source : atlas_sources)
 	{
-		cout << "ERROR: Could not open file player_spaceship.png" << endl;
-		return -1;
+		filesystem::file_time_type source_time = filesystem::last_write_time(source, error);
+
+		if (!error && source_time > baked_time)
+			return false;
+	}
+
+	return true;
+}
+
+// Loads the prebaked atlas, or builds it from the sprite images and saves it
+// if there is none or it is older than the images, then loads it into atlas_texture and looks up every rect.
+bool load_atlas()
+{
+	TextureAtlas atlas;
+
+	bool prebaked = atlas_is_current()
+		&& atlas.loadFromFile(atlas_image_file, atlas_index_file)
+		&& atlas.find("player_spaceship.png") != TextureAtlas::npos
+		&& atlas.find("enemy_spaceship.png") != TextureAtlas::npos
+		&& atlas.find("projectile") != TextureAtlas::npos;
+
+	if (!prebaked)
+	{
+		atlas = TextureAtlas();
+
+		if (atlas.addFromFile("player_spaceship.png") == TextureAtlas::npos)
+		{
+			cout << "ERROR: Could not open file player_spaceship.png" << endl;
+			return false;
+		}
+
+		if (atlas.addFromFile("enemy_spaceship.png") == TextureAtlas::npos)
+		{
+			cout << "ERROR: Could not open file enemy_spaceship.png" << endl;
+			return false;
+		}
+
+		// Projectiles are plain rectangles, so their image is made here.
+		Image projectile_image;
+		projectile_image.create(4u, 12u, Color::Yellow);
+		atlas.add("projectile", projectile_image);
+
+		if (!atlas.build())
+		{
+			cout << "ERROR: Could not pack the sprites into an atlas" << endl;
+			return false;
+		}
+
+		// Not being able to save only costs the next startup some time.
+		if (!atlas.saveToFile(atlas_image_file, atlas_index_file))
+			cout << "WARNING: Could not write file " << atlas_image_file << " or " << atlas_index_file << endl;
 	}
 
-	Game game(window_width, window_height);
+	if (!atlas_texture.loadFromImage(atlas.image()))
+	{
+		cout << "ERROR: Could not create the atlas texture" << endl;
+		return false;
+	}
+
+	player_sprite_rect = atlas.rect(atlas.find("player_spaceship.png"));
+	enemy_sprite_rect = atlas.rect(atlas.find("enemy_spaceship.png"));
+	projectile_sprite_rect = atlas.rect(atlas.find("projectile"));
+	return true;
+}
+
+void print_usage()
+{
+	cout << "Usage: Spaceship Game [--seed <n>] [--record <file>]" << endl
+	     << "  --seed <n>         Seed of the game (default: random)" << endl
+	     << "  --record <file>    Record the game to file, to be replayed by the" << endl
+	     << "                     Benchmark target with --replay" << endl;
+}
+
+// Reads a seed that must be a whole number in the range of uint32_t.
+// Returns false, and leaves seed untouched, if text is anything else.
+bool parse_seed(const string& text, uint32_t& seed)
+{
+	const char* end = text.data() + text.size();
+	uint32_t value = 0u;
+	from_chars_result result = from_chars(text.data(), end, value);
+
+	if (text.empty() || result.ec != errc() || result.ptr != end)
+		return false;
+
+	seed = value;
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	uint32_t seed = random_device()();
+	string record_file;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		string arg = argv[i];
+
+		if (arg == "--seed" && i + 1 < argc)
+		{
+			if (!parse_seed(argv[++i], seed))
+			{
+				cout << "ERROR: Invalid seed " << argv[i] << endl;
+				print_usage();
+				return 1;
+			}
+		}
+		else if (arg == "--record" && i + 1 < argc)
+			record_file = argv[++i];
+		else
+		{
+			cout << "ERROR: Unknown or incomplete option " << arg << endl;
+			print_usage();
+			return 1;
+		}
+	}
+
+	if (!load_atlas())
+		return -1;
+
+	Game game(window_width, window_height, seed);
+
+	if (!record_file.empty())
+		game.startRecording(record_file);
+
 	game.run();
 
 	return 0;
@@ -0,0 +1,986 @@
+// Spaceship Game
+// math_benchmark_main.cpp
+// Justyn Durnford
+// Created on 2026-10-16
+// Last modified on 2026-10-17
+// Main file of the headless MathBenchmark target.
+//
+// Usage: MathBenchmark [sizes...]
+//   sizes              DynamicMatrix sizes to multiply (default: 256 512 1024)
+//
+// Times the sf::Matrix determinant, inverse and solve of random matrices:
+// the recursive cofactor expansion that determinant() used to be,
+// against the closed forms for small sizes and LU decomposition.
+//
+// Then times the product of two square DynamicMatrix<float>s: a plain
+// triple loop, against multiply() on one thread and on every thread.
+// Transpose and sum are timed on one thread and on every thread as well.
+//
+// Then times A + B * s - C, element-wise, three ways: with a full copy
+// after every operator the way the Matrix operators used to work, with
+// the expression templates the operators now return, and as one loop
+// written by hand. The same is done for arrays of Vector2f, whose
+// operators are plain functions that the compiler already fuses.
+//
+// Then times parallel_for_each(), parallel_transform(), parallel_reduce(),
+// parallel_map_reduce() and a row by row parallel_for() over a 2048 x 2048
+// Table<float>, on ThreadPools of 1, 2, 4... threads up to the number of
+// hardware threads, with the speedup over one thread.
+//
+// Then times the batch operations of VectorMath.hpp over 4096 agents:
+// distances to a target, normalising headings, and every agent's nearest
+// neighbour, against the per-pair loops through std::pow() on double they
+// replace, and checks them against plain float loops.
+//
+// Then times Fraction<int64_t> arithmetic over long accumulations whose
+// exact results are known: a telescoping sum of 1 / (k * (k + 1)), which
+// overflowed within a few dozen terms before sums were reduced as they went,
+// and a product of (k + 1) / k.
+//
+// Then fills a 100000 x 100000 ChunkedTable<uint16_t> with a sparse grid
+// of roads, and times saving it, mapping it back in and reading from it,
+// against the memory the same table would take dense. Copies of the file
+// with corrupt dimensions must be refused.
+//
+// Then times resizing, allocating and copying vectors of 4 million Point2f,
+// now a trivial type, against a copy of Point2f with the constructor that
+// set both coordinates to zero in its body.
+//
+// Exits with 1 if any of them disagree.
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderQueue.hpp>
+#include <SFML/System/ChunkedTable.hpp>
+#include <SFML/System/DynamicMatrix.hpp>
+#include <SFML/System/Fraction.hpp>
+#include <SFML/System/Matrix.hpp>
+#include <SFML/System/Parallel.hpp>
+#include <SFML/System/Table.hpp>
+#include <SFML/System/ThreadPool.hpp>
+#include <SFML/System/VectorMath.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <span>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace sf;
+using namespace std;
+
+// Roughly how many matrix operations each measurement performs.
+const size_t operations_per_test = 2000000u;
+
+// Matrices are cycled through so that every call sees new input.
+const size_t matrix_count = 1024u;
+
+// Results are written here so that the calls cannot be optimised away.
+volatile double sink;
+
+// Calls operation(i) count times, for i cycling through [0, pool),
+// and returns the average time of one call in nanoseconds.
+template <typename Function>
+double measure(size_t count, Function operation, size_t pool = matrix_count)
+{
+	auto start = chrono::steady_clock::now();
+
+	for (size_t i = 0; i < count; ++i)
+		operation(i % pool);
+
+	auto end = chrono::steady_clock::now();
+	return chrono::duration<double, nano>(end - start).count() / static_cast<double>(count);
+}
+
+// Determinant by expanding along the first row, copying every minor
+// into a temporary Matrix, the way determinant() used to work.
+template <typename T, size_t N>
+T determinant_cofactor(const Matrix<T, N, N>& M)
+{
+	if constexpr (N == 1u)
+		return M(0, 0);
+	else
+	{
+		T det = static_cast<T>(0);
+		T sign = static_cast<T>(1);
+
+		for (size_t col = 0; col < N; ++col)
+		{
+			Matrix<T, N - 1, N - 1> minor;
+
+			for (size_t r = 1; r < N; ++r)
+			{
+				for (size_t c = 0, m = 0; c < N; ++c)
+				{
+					if (c != col)
+						minor(m++, r - 1) = M(c, r);
+				}
+			}
+
+			det += sign * M(col, 0) * determinant_cofactor(minor);
+			sign = -sign;
+		}
+
+		return det;
+	}
+}
+
+// Returns the largest difference between an element of M and the identity.
+template <size_t N>
+double identity_error(const Matrix<double, N, N>& M)
+{
+	double error = 0.0;
+
+	for (size_t r = 0; r < N; ++r)
+	{
+		for (size_t c = 0; c < N; ++c)
+			error = max(error, abs(M(c, r) - (r == c ? 1.0 : 0.0)));
+	}
+
+	return error;
+}
+
+// Times and checks every operation for N by N matrices of doubles.
+// Returns false if any results disagree.
+template <size_t N>
+bool benchmark_size(default_random_engine& engine)
+{
+	uniform_real_distribution<double> dist(-1.0, 1.0);
+	vector<Matrix<double, N, N>> matrices(matrix_count, Matrix<double, N, N>(0.0));
+	vector<array<double, N>> vectors(matrix_count);
+
+	for (size_t i = 0; i < matrix_count; ++i)
+	{
+		for (size_t r = 0; r < N; ++r)
+		{
+			vectors[i][r] = dist(engine);
+
+			for (size_t c = 0; c < N; ++c)
+				matrices[i](c, r) = dist(engine);
+
+			// Keep the matrices well conditioned.
+			matrices[i](r, r) += static_cast<double>(N);
+		}
+	}
+
+	// The cofactor expansion takes N! steps, so it gets far fewer calls.
+	size_t cofactor_count = N <= 4u ? operations_per_test : N <= 8u ? operations_per_test / 1000u : 0u;
+	size_t count = max<size_t>(operations_per_test / (N * N), 1000u);
+	bool ok = true;
+
+	double cofactor_ns = 0.0;
+
+	if (cofactor_count > 0u)
+		cofactor_ns = measure(cofactor_count, [&](size_t i) { sink = determinant_cofactor(matrices[i]); });
+
+	double det_ns = measure(count, [&](size_t i) { sink = determinant(matrices[i]); });
+	double lu_det_ns = measure(count, [&](size_t i) { sink = lu_decompose(matrices[i]).determinant(); });
+	double inverse_ns = measure(count, [&](size_t i) { sink = inverse(matrices[i])(0, 0); });
+	double solve_ns = measure(count, [&](size_t i) { sink = solve(matrices[i], vectors[i])[0]; });
+
+	for (size_t i = 0; i < matrix_count; ++i)
+	{
+		const Matrix<double, N, N>& M = matrices[i];
+		double det = determinant(M);
+		double tolerance = 1e-9 * max(1.0, abs(det));
+
+		if (abs(lu_decompose(M).determinant() - det) > tolerance)
+			ok = false;
+		if (cofactor_count > 0u && abs(determinant_cofactor(M) - det) > tolerance)
+			ok = false;
+		if (identity_error(inverse(M) * M) > 1e-9)
+			ok = false;
+
+		array<double, N> x = solve(M, vectors[i]);
+		array<double, N> b = M * x;
+
+		for (size_t r = 0; r < N; ++r)
+		{
+			if (abs(b[r] - vectors[i][r]) > 1e-9)
+				ok = false;
+		}
+	}
+
+	cout << fixed << setprecision(1) << setw(6) << N;
+
+	if (cofactor_count > 0u)
+		cout << setw(14) << cofactor_ns;
+	else
+		cout << setw(14) << "-";
+
+	cout << setw(14) << det_ns << setw(14) << lu_det_ns << setw(14) << inverse_ns
+	     << setw(14) << solve_ns << endl;
+
+	return ok;
+}
+
+// Matrices per pool in the expression benchmark, kept small enough
+// that the pools stay in cache.
+const size_t expression_pool = 16u;
+
+// Times A + B * s - C for N by N matrices of floats.
+// Returns false if the three ways disagree.
+template <size_t N>
+bool benchmark_expression(default_random_engine& engine)
+{
+	using M = Matrix<float, N, N>;
+
+	uniform_real_distribution<float> dist(-1.f, 1.f);
+	vector<M> a(expression_pool, M(0.f)), b(expression_pool, M(0.f)), c(expression_pool, M(0.f));
+	vector<M> eager_out(expression_pool, M(0.f)), lazy_out(expression_pool, M(0.f)), fused_out(expression_pool, M(0.f));
+	const float s = 0.5f;
+
+	for (size_t i = 0; i < expression_pool; ++i)
+	{
+		for (size_t e = 0; e < N * N; ++e)
+		{
+			a[i].data()[e] = dist(engine);
+			b[i].data()[e] = dist(engine);
+			c[i].data()[e] = dist(engine);
+		}
+	}
+
+	size_t count = max<size_t>(operations_per_test * 16u / (N * N), 1000u);
+
+	// One temporary Matrix per operator, as the operators used to return.
+	double eager_ns = measure(count, [&](size_t i)
+	{
+		size_t k = i % expression_pool;
+		M scaled(b[k]);
+		scaled *= s;
+		M added(a[k]);
+		added += scaled;
+		M result(added);
+		result -= c[k];
+		eager_out[k] = result;
+	});
+
+	double lazy_ns = measure(count, [&](size_t i)
+	{
+		size_t k = i % expression_pool;
+		lazy_out[k] = a[k] + b[k] * s - c[k];
+	});
+
+	double fused_ns = measure(count, [&](size_t i)
+	{
+		size_t k = i % expression_pool;
+		const float* pa = a[k].data();
+		const float* pb = b[k].data();
+		const float* pc = c[k].data();
+		float* out = fused_out[k].data();
+
+		for (size_t e = 0; e < N * N; ++e)
+			out[e] = pa[e] + pb[e] * s - pc[e];
+	});
+
+	bool ok = true;
+
+	for (size_t k = 0; k < expression_pool; ++k)
+	{
+		for (size_t e = 0; e < N * N; ++e)
+		{
+			if (eager_out[k].data()[e] != fused_out[k].data()[e] || lazy_out[k].data()[e] != fused_out[k].data()[e])
+				ok = false;
+		}
+	}
+
+	cout << fixed << setprecision(1) << setw(10) << N << setw(14) << eager_ns << setw(14) << lazy_ns
+	     << setw(14) << fused_ns << setw(14) << sizeof(M) * 3u << endl;
+
+	return ok;
+}
+
+// The free functions that take a square Matrix take expressions too,
+// as they took the Matrix the operators used to return.
+constexpr Matrix<double, 2, 2> expression_a = { { 4.0, 1.0 }, { 2.0, 3.0 } };
+constexpr Matrix<double, 2, 2> expression_b = { { 1.0, 0.0 }, { 1.0, 1.0 } };
+constexpr Matrix<double, 4, 4> expression_c = { { 2.0, 0.0, 0.0, 1.0 }, { 0.0, 3.0, 0.0, 0.0 }, { 0.0, 0.0, 4.0, 0.0 }, { 0.0, 0.0, 0.0, 5.0 } };
+static_assert(determinant(expression_a + expression_b) == 17.0);
+static_assert(inverse(expression_a - expression_b * 2.0)(0, 0) == 0.5);
+static_assert(transpose(expression_a * 2.0)(1, 0) == 4.0);
+static_assert(solve(expression_a + expression_b, array<double, 2>{ 5.0, 3.0 })[0] == 1.0);
+static_assert(lu_decompose(expression_c / 2.0).determinant() == 7.5);
+
+// RenderQueue.hpp, included ahead of the System headers, brings in the
+// priv::Matrix of Glsl.hpp, which must not hide sf::Matrix inside priv.
+static_assert(priv::is_matrix<Matrix<double, 2, 2>>::value && !priv::is_matrix<Glsl::Mat3>::value);
+
+// Times a + b * s - c over arrays of Vector2f with the operators, and by hand.
+// Returns false if the two disagree.
+bool benchmark_vector_expression(default_random_engine& engine)
+{
+	const size_t count = 1u << 20;
+	const float s = 0.5f;
+
+	uniform_real_distribution<float> dist(-1.f, 1.f);
+	vector<Vector2f> a(count), b(count), c(count), operator_out(count), fused_out(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		a[i] = Vector2f(dist(engine), dist(engine));
+		b[i] = Vector2f(dist(engine), dist(engine));
+		c[i] = Vector2f(dist(engine), dist(engine));
+	}
+
+	double operator_ns = measure(count * 16u, [&](size_t i)
+	{
+		operator_out[i] = a[i] + b[i] * s - c[i];
+	}, count);
+
+	double fused_ns = measure(count * 16u, [&](size_t i)
+	{
+		fused_out[i].x = a[i].x + b[i].x * s - c[i].x;
+		fused_out[i].y = a[i].y + b[i].y * s - c[i].y;
+	}, count);
+
+	cout << setw(10) << "Vector2f" << setw(14) << operator_ns << setw(14) << "-"
+	     << setw(14) << fused_ns << setw(14) << sizeof(Vector2f) * 3u << endl;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (operator_out[i].x != fused_out[i].x || operator_out[i].y != fused_out[i].y)
+			return false;
+	}
+
+	return true;
+}
+
+// Returns the seconds taken by one call to operation.
+template <typename Function>
+double time_once(Function operation)
+{
+	auto start = chrono::steady_clock::now();
+	operation();
+	auto end = chrono::steady_clock::now();
+
+	return chrono::duration<double>(end - start).count();
+}
+
+// Returns false if multiply() and the plain triple loop disagree.
+bool benchmark_gemm(const vector<size_t>& sizes, default_random_engine& engine)
+{
+	uniform_real_distribution<float> dist(-1.f, 1.f);
+	size_t threads = max(thread::hardware_concurrency(), 1u);
+	bool ok = true;
+
+	cout << endl << "DynamicMatrix<float> product, GFLOP/s (" << threads << " hardware threads)" << endl;
+	cout << setw(6) << "N" << setw(14) << "triple loop" << setw(14) << "1 thread"
+	     << setw(14) << "all threads" << setw(14) << "transpose 1" << setw(14) << "transpose all"
+	     << setw(14) << "sum 1" << setw(14) << "sum all" << "   (transpose and sum in ms)" << endl;
+
+	for (size_t n : sizes)
+	{
+		DynamicMatrix<float> A(n, n), B(n, n), naive(n, n), blocked, parallel;
+
+		for (size_t i = 0; i < A.size(); ++i)
+		{
+			A.data()[i] = dist(engine);
+			B.data()[i] = dist(engine);
+		}
+
+		// The textbook loop, walking down the columns of B.
+		double naive_s = time_once([&]()
+		{
+			for (size_t y = 0; y < n; ++y)
+			{
+				for (size_t x = 0; x < n; ++x)
+				{
+					float total = 0.f;
+
+					for (size_t k = 0; k < n; ++k)
+						total += A(k, y) * B(x, k);
+
+					naive(x, y) = total;
+				}
+			}
+		});
+
+		double blocked_s = time_once([&]() { multiply(A, B, blocked, 1u); });
+		double parallel_s = time_once([&]() { multiply(A, B, parallel, 0u); });
+
+		double transpose_1_ms = time_once([&]() { sink = transpose(A, 1u)(0, 0); }) * 1000.0;
+		double transpose_all_ms = time_once([&]() { sink = transpose(A, 0u)(0, 0); }) * 1000.0;
+		double sum_1_ms = time_once([&]() { sink = sum(A, 1u); }) * 1000.0;
+		double sum_all_ms = time_once([&]() { sink = sum(A, 0u); }) * 1000.0;
+
+		for (size_t i = 0; i < naive.size(); ++i)
+		{
+			float tolerance = 1e-3f * static_cast<float>(n);
+
+			if (abs(naive.data()[i] - blocked.data()[i]) > tolerance || blocked.data()[i] != parallel.data()[i])
+				ok = false;
+		}
+
+		double flop = 2.0 * static_cast<double>(n) * static_cast<double>(n) * static_cast<double>(n);
+
+		cout << fixed << setprecision(2) << setw(6) << n << setw(14) << flop / naive_s / 1e9
+		     << setw(14) << flop / blocked_s / 1e9 << setw(14) << flop / parallel_s / 1e9
+		     << setw(14) << transpose_1_ms << setw(14) << transpose_all_ms
+		     << setw(14) << sum_1_ms << setw(14) << sum_all_ms << endl;
+	}
+
+	return ok;
+}
+
+// Returns the fewest seconds taken by one call to operation over repeats calls.
+template <typename Function>
+double time_best(size_t repeats, Function operation)
+{
+	double best = time_once(operation);
+
+	for (size_t i = 1; i < repeats; ++i)
+		best = min(best, time_once(operation));
+
+	return best;
+}
+
+// Returns false if the results on any ThreadPool differ from
+// the results on a ThreadPool of one thread.
+bool benchmark_parallel(default_random_engine& engine)
+{
+	const size_t n = 2048u;
+	const size_t repeats = 5u;
+
+	uniform_real_distribution<float> dist(0.f, 1.f);
+	Table<float> source(n, n);
+
+	for (size_t i = 0; i < source.size(); ++i)
+		source.data()[i] = dist(engine);
+
+	size_t hardware = max(thread::hardware_concurrency(), 1u);
+	vector<size_t> thread_counts;
+
+	for (size_t t = 1; t < hardware; t *= 2u)
+		thread_counts.push_back(t);
+
+	thread_counts.push_back(hardware);
+
+	cout << endl << "Table<float> " << n << " x " << n << ", ms (speedup over 1 thread)" << endl;
+	cout << setw(8) << "threads" << setw(18) << "for_each" << setw(18) << "transform"
+	     << setw(18) << "reduce" << setw(18) << "map_reduce" << setw(18) << "diffuse rows" << endl;
+
+	array<double, 5> base_ms = {};
+	Table<float> base_each, base_transformed, base_diffused;
+	float base_sum = 0.f;
+	size_t base_count = 0u;
+	bool ok = true;
+
+	for (size_t threads : thread_counts)
+	{
+		ThreadPool pool(threads);
+		Table<float> each, transformed(n, n), diffused(n, n);
+		float total = 0.f;
+		size_t count = 0u;
+		array<double, 5> ms;
+
+		ms[0] = time_best(repeats, [&]()
+		{
+			each = source;
+			parallel_for_each(pool, each, [](float& value) { value = value * 0.99f + 0.01f; });
+		});
+
+		ms[1] = time_best(repeats, [&]()
+		{
+			parallel_transform(pool, source, transformed, [](float value) { return sqrt(value) * sin(value); });
+		});
+
+		ms[2] = time_best(repeats, [&]()
+		{
+			total = parallel_reduce(pool, source, 0.f, [](float a, float b) { return a + b; });
+		});
+
+		ms[3] = time_best(repeats, [&]()
+		{
+			count = parallel_map_reduce(pool, source, size_t(0u),
+				[](float value) { return value > 0.5f ? size_t(1u) : size_t(0u); },
+				[](size_t a, size_t b) { return a + b; });
+		});
+
+		// One step of heat diffusion: every cell moves towards the
+		// average of its four neighbours, read from the previous step.
+		ms[4] = time_best(repeats, [&]()
+		{
+			parallel_for(pool, n, 16u, [&](size_t first, size_t last)
+			{
+				for (size_t y = first; y < last; ++y)
+				{
+					span<const float> up = source.row(y > 0u ? y - 1u : y);
+					span<const float> row = source.row(y);
+					span<const float> down = source.row(y + 1u < n ? y + 1u : y);
+					span<float> out = diffused.row(y);
+
+					for (size_t x = 0; x < n; ++x)
+					{
+						float left = row[x > 0u ? x - 1u : x];
+						float right = row[x + 1u < n ? x + 1u : x];
+						out[x] = row[x] + 0.2f * (up[x] + down[x] + left + right - 4.f * row[x]);
+					}
+				}
+			});
+		});
+
+		for (double& value : ms)
+			value *= 1000.0;
+
+		if (threads == 1u)
+		{
+			base_ms = ms;
+			base_each = each;
+			base_transformed = transformed;
+			base_diffused = diffused;
+			base_sum = total;
+			base_count = count;
+		}
+		else
+		{
+			bool same = equal(each.data(), each.data() + each.size(), base_each.data())
+			         && equal(transformed.data(), transformed.data() + transformed.size(), base_transformed.data())
+			         && equal(diffused.data(), diffused.data() + diffused.size(), base_diffused.data());
+
+			// Summing in another order rounds differently.
+			if (!same || count != base_count || abs(total - base_sum) > 1e-4f * base_sum)
+				ok = false;
+		}
+
+		cout << setw(8) << threads;
+
+		for (size_t i = 0; i < ms.size(); ++i)
+		{
+			ostringstream cell;
+			cell << fixed << setprecision(2) << ms[i] << " (" << setprecision(1) << base_ms[i] / ms[i] << "x)";
+			cout << setw(18) << cell.str();
+		}
+
+		cout << endl;
+	}
+
+	return ok;
+}
+
+// The plain loops are compiled without contraction too, as the batch
+// operations are, so that both round the same way on FMA targets.
+SFML_VECTORMATH_CONTRACT_OFF
+
+// Returns false if the batch operations disagree with plain float loops.
+bool benchmark_vector_math(default_random_engine& engine)
+{
+	const size_t agents = 4096u;
+	const size_t repeats = 20u;
+
+	uniform_real_distribution<float> dist(-1000.f, 1000.f);
+	vector<Point2f> positions(agents);
+	vector<Vector2f> headings(agents);
+	Point2f target(dist(engine), dist(engine));
+
+	for (size_t i = 0; i < agents; ++i)
+	{
+		positions[i] = Point2f(dist(engine), dist(engine));
+		headings[i] = Vector2f(dist(engine), dist(engine));
+	}
+
+	vector<double> pow_distances(agents);
+	vector<float> loop_distances(agents), batch_distances(agents);
+
+	// How distance_between() and magnitude() used to work.
+	double pow_us = time_best(repeats, [&]()
+	{
+		for (size_t i = 0; i < agents; ++i)
+			pow_distances[i] = sqrt(pow(positions[i].x - target.x, 2) + pow(positions[i].y - target.y, 2));
+	}) * 1e6;
+
+	double loop_us = time_best(repeats, [&]()
+	{
+		for (size_t i = 0; i < agents; ++i)
+			loop_distances[i] = distance_between(target, positions[i]);
+	}) * 1e6;
+
+	double batch_us = time_best(repeats, [&]() { distances(positions, target, batch_distances); }) * 1e6;
+
+	vector<Vector2f> pow_units(agents), batch_units(agents);
+
+	double pow_normalize_us = time_best(repeats, [&]()
+	{
+		for (size_t i = 0; i < agents; ++i)
+		{
+			float m = static_cast<float>(sqrt(pow(headings[i].x, 2) + pow(headings[i].y, 2)));
+			pow_units[i] = Vector2f(headings[i].x / m, headings[i].y / m);
+		}
+	}) * 1e6;
+
+	double batch_normalize_us = time_best(repeats, [&]()
+	{
+		batch_units = headings;
+		normalize(batch_units);
+	}) * 1e6;
+
+	vector<size_t> loop_nearest(agents), batch_nearest(agents);
+
+	double loop_nearest_us = time_once([&]()
+	{
+		for (size_t i = 0; i < agents; ++i)
+		{
+			float best = numeric_limits<float>::infinity();
+			loop_nearest[i] = agents;
+
+			for (size_t j = 0; j < agents; ++j)
+			{
+				float d = squared_distance_between(positions[i], positions[j]);
+
+				if (j != i && d < best)
+				{
+					best = d;
+					loop_nearest[i] = j;
+				}
+			}
+		}
+	}) * 1e6;
+
+	double batch_nearest_us = time_once([&]() { nearest_neighbours(positions, batch_nearest); }) * 1e6;
+
+	bool ok = loop_nearest == batch_nearest;
+
+	for (size_t i = 0; i < agents; ++i)
+	{
+		float m = headings[i].magnitude();
+
+		if (loop_distances[i] != batch_distances[i] || batch_units[i].x != headings[i].x / m || batch_units[i].y != headings[i].y / m)
+			ok = false;
+	}
+
+	cout << endl << "VectorMath over " << agents << " agents (" << vector_math_isa() << "), us per call" << endl;
+	cout << setw(24) << "" << setw(14) << "pow, double" << setw(14) << "float loop" << setw(14) << "batch" << endl;
+	cout << fixed << setprecision(2)
+	     << setw(24) << "distances to target" << setw(14) << pow_us << setw(14) << loop_us << setw(14) << batch_us << endl
+	     << setw(24) << "normalize headings" << setw(14) << pow_normalize_us << setw(14) << "-" << setw(14) << batch_normalize_us << endl
+	     << setw(24) << "nearest neighbours" << setw(14) << "-" << setw(14) << loop_nearest_us << setw(14) << batch_nearest_us << endl;
+
+	return ok;
+}
+
+SFML_VECTORMATH_CONTRACT_RESTORE
+
+// Returns false if either accumulation does not come out exact.
+bool benchmark_fraction()
+{
+	const int64_t n = 1000000;
+
+	Fraction<int64_t> total;
+	double sum_ns = time_once([&]()
+	{
+		for (int64_t k = 1; k <= n; ++k)
+			total += Fraction<int64_t>(1, k * (k + 1));
+	}) * 1e9 / static_cast<double>(n);
+
+	Fraction<int64_t> product(1);
+	double product_ns = time_once([&]()
+	{
+		for (int64_t k = 1; k <= n; ++k)
+			product *= Fraction<int64_t>(k + 1, k);
+	}) * 1e9 / static_cast<double>(n);
+
+	Fraction<int64_t> power(3, 2);
+	double pow_ns = time_once([&]()
+	{
+		for (int64_t k = 0; k < n; ++k)
+		{
+			Fraction<int64_t> p(3, 2);
+			p.pow(39u);
+			power = p;
+		}
+	}) * 1e9 / static_cast<double>(n);
+
+	cout << endl << "Fraction<int64_t>, ns per call over " << n << " calls" << endl;
+	cout << fixed << setprecision(2)
+	     << setw(24) << "sum 1 / (k * (k + 1))" << setw(14) << sum_ns << "   = " << total.toString() << endl
+	     << setw(24) << "product (k + 1) / k" << setw(14) << product_ns << "   = " << product.toString() << endl
+	     << setw(24) << "(3 / 2) to the 39th" << setw(14) << pow_ns << "   = " << power.toString() << endl;
+
+	return total == Fraction<int64_t>(n, n + 1) && product == Fraction<int64_t>(n + 1)
+	    && power == Fraction<int64_t>(4052555153018976267, 549755813888);
+}
+
+// Returns true if a copy of the saved file with rows x cols written into its
+// header is refused by openFromFile(), leaving the table as it was.
+bool rejects_dimensions(const string& filename, uint64_t rows, uint64_t cols)
+{
+	string corrupt = filename + ".corrupt";
+	filesystem::copy_file(filename, corrupt, filesystem::copy_options::overwrite_existing);
+
+	{
+		fstream file(corrupt, ios::binary | ios::in | ios::out);
+		file.seekp(8);
+		file.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+		file.write(reinterpret_cast<const char*>(&cols), sizeof(cols));
+	}
+
+	ChunkedTable<uint16_t> table(3u, 5u);
+	bool rejected = !table.openFromFile(corrupt) && table.rowCount() == 3u && table.colCount() == 5u;
+	filesystem::remove(corrupt);
+
+	return rejected;
+}
+
+// Returns false if the ChunkedTable mapped back in differs from the one saved,
+// or if files with corrupt dimensions or an impossible resize are accepted.
+bool benchmark_chunked_table(default_random_engine& engine)
+{
+	const size_t n = 100000u;
+	const uint16_t grass = 0u;
+	const uint16_t road = 1u;
+
+	ChunkedTable<uint16_t> world(n, n, grass);
+
+	// A road along every 10000th row and column.
+	double fill_ms = time_once([&]()
+	{
+		for (size_t a = 0; a < n; a += 10000u)
+		{
+			for (size_t b = 0; b < n; ++b)
+			{
+				world.set(b, a, road);
+				world.set(a, b, road);
+			}
+		}
+	}) * 1000.0;
+
+	string filename = (filesystem::temp_directory_path() / "math_benchmark_world.bin").string();
+	bool saved = false;
+	double save_ms = time_once([&]() { saved = world.saveToFile(filename); }) * 1000.0;
+
+	ChunkedTable<uint16_t> mapped;
+	bool opened = false;
+	double open_ms = time_once([&]() { opened = mapped.openFromFile(filename); }) * 1000.0;
+
+	// Reads through a const reference, so that no chunk is copied out of the file.
+	const ChunkedTable<uint16_t>& view = mapped;
+	uniform_int_distribution<size_t> dist(0u, n - 1u);
+	vector<pair<size_t, size_t>> cells(100000u);
+
+	for (auto& cell : cells)
+		cell = { dist(engine), (dist(engine) / 10000u) * 10000u };
+
+	bool ok = saved && opened && view.populatedCount() == world.populatedCount();
+	size_t roads = 0u;
+
+	double read_ms = time_once([&]()
+	{
+		for (const auto& cell : cells)
+			roads += view(cell.first, cell.second) == road;
+	}) * 1000.0;
+
+	if (roads != cells.size())
+		ok = false;
+
+	for (const TableChunk<const uint16_t>& chunk : view.chunks())
+	{
+		for (size_t y = 0; y < chunk.rows && ok; ++y)
+		{
+			for (size_t x = 0; x < chunk.cols; ++x)
+			{
+				if (chunk(x, y) != world.at(chunk.x + x, chunk.y + y))
+					ok = false;
+			}
+		}
+	}
+
+	size_t file_bytes = saved ? static_cast<size_t>(filesystem::file_size(filename)) : 0u;
+	mapped = ChunkedTable<uint16_t>();
+
+	// Dimensions whose chunk count wraps to 0, overflows a size_t, or
+	// needs an offset table larger than the whole file.
+	const uint64_t max_dimension = numeric_limits<uint64_t>::max();
+
+	if (saved && (!rejects_dimensions(filename, max_dimension, max_dimension)
+		|| !rejects_dimensions(filename, uint64_t(1u) << 40, uint64_t(1u) << 40)
+		|| !rejects_dimensions(filename, n, n * 64u)))
+		ok = false;
+
+	filesystem::remove(filename);
+
+	try
+	{
+		ChunkedTable<uint16_t> huge(3u, 5u);
+		huge.resize(numeric_limits<size_t>::max(), numeric_limits<size_t>::max());
+		ok = false;
+	}
+	catch (const length_error&) {}
+
+	double dense_mib = static_cast<double>(n) * static_cast<double>(n) * sizeof(uint16_t) / 1048576.0;
+
+	cout << endl << "ChunkedTable<uint16_t> " << n << " x " << n << ", " << world.populatedCount()
+	     << " of " << world.chunkCount() << " chunks populated" << endl;
+	cout << fixed << setprecision(2)
+	     << setw(24) << "dense MiB" << setw(14) << dense_mib << endl
+	     << setw(24) << "chunks MiB" << setw(14) << world.memoryUsage() / 1048576.0 << endl
+	     << setw(24) << "file MiB" << setw(14) << file_bytes / 1048576.0 << endl
+	     << setw(24) << "fill ms" << setw(14) << fill_ms << endl
+	     << setw(24) << "save ms" << setw(14) << save_ms << endl
+	     << setw(24) << "open ms" << setw(14) << open_ms << endl
+	     << setw(24) << "100000 mapped reads ms" << setw(14) << read_ms << endl;
+
+	return ok;
+}
+
+// Point2f as it was before its default constructor was defaulted.
+struct LegacyPoint2f
+{
+	float x;
+	float y;
+
+	LegacyPoint2f()
+	{
+		x = 0.f;
+		y = 0.f;
+	}
+
+	LegacyPoint2f(float X, float Y)
+	{
+		x = X;
+		y = Y;
+	}
+};
+
+// Built at compile time, which Point2f's old constructors did not allow.
+constexpr array<Point2f, 4> unit_square = { Point2f(0.f, 0.f), Point2f(1.f, 0.f), Point2f(1.f, 1.f), Point2f(0.f, 1.f) };
+static_assert(squared_distance_between(unit_square[0], unit_square[2]) == 2.f);
+static_assert(FloatRect(unit_square[0], unit_square[2]).area() == 1.f);
+
+// Times resizing, allocating and copying n points of type P,
+// and returns false if resize() did not leave every point at zero.
+template <typename P>
+bool benchmark_points(const char* name, size_t n, default_random_engine& engine)
+{
+	vector<P> resized;
+	double resize_ms = time_best(5u, [&]()
+	{
+		vector<P> points;
+		points.resize(n);
+		resized = move(points);
+	}) * 1000.0;
+
+	bool ok = all_of(resized.begin(), resized.end(), [](const P& p) { return p.x == 0.f && p.y == 0.f; });
+
+	double allocate_ms = time_best(5u, [&]()
+	{
+		unique_ptr<P[]> points = make_unique_for_overwrite<P[]>(n);
+		points[n - 1u].x = 1.f;
+		sink = points[n - 1u].x;
+	}) * 1000.0;
+
+	uniform_real_distribution<float> dist(-1000.f, 1000.f);
+	vector<P> source;
+	source.reserve(n);
+
+	for (size_t i = 0; i < n; ++i)
+		source.emplace_back(dist(engine), dist(engine));
+
+	vector<P> copy;
+	double copy_ms = time_best(5u, [&]()
+	{
+		copy = vector<P>(source);
+	}) * 1000.0;
+
+	ok = ok && copy.size() == n && copy.back().x == source.back().x;
+
+	cout << setw(16) << name << boolalpha << setw(10) << is_trivial_v<P> << setw(14) << is_trivially_copyable_v<P>
+	     << fixed << setprecision(2) << setw(14) << resize_ms << setw(14) << allocate_ms << setw(14) << copy_ms << endl;
+
+	return ok;
+}
+
+int main(int argc, char** argv)
+{
+	default_random_engine engine(12345u);
+	vector<size_t> sizes;
+
+	for (int i = 1; i < argc; ++i)
+		sizes.push_back(stoul(argv[i]));
+
+	if (sizes.empty())
+		sizes = { 256u, 512u, 1024u };
+
+	cout << "Matrix<double, N, N>, ns per call" << endl;
+	cout << setw(6) << "N" << setw(14) << "cofactor det" << setw(14) << "determinant"
+	     << setw(14) << "LU det" << setw(14) << "inverse" << setw(14) << "solve" << endl;
+
+	bool ok = benchmark_size<2>(engine);
+	ok = benchmark_size<3>(engine) && ok;
+	ok = benchmark_size<4>(engine) && ok;
+	ok = benchmark_size<6>(engine) && ok;
+	ok = benchmark_size<8>(engine) && ok;
+	ok = benchmark_size<16>(engine) && ok;
+	ok = benchmark_size<32>(engine) && ok;
+
+	if (!ok)
+		cout << "ERROR: determinant, inverse and solve disagree" << endl;
+
+	cout << endl << "A + B * s - C, ns per evaluation" << endl;
+	cout << setw(10) << "N" << setw(14) << "copies" << setw(14) << "expression"
+	     << setw(14) << "by hand" << setw(14) << "input bytes" << endl;
+
+	bool expressions_ok = benchmark_expression<4>(engine);
+	expressions_ok = benchmark_expression<16>(engine) && expressions_ok;
+	expressions_ok = benchmark_expression<64>(engine) && expressions_ok;
+	expressions_ok = benchmark_vector_expression(engine) && expressions_ok;
+
+	if (!expressions_ok)
+	{
+		cout << "ERROR: expression templates and copies disagree" << endl;
+		ok = false;
+	}
+
+	if (!benchmark_gemm(sizes, engine))
+	{
+		cout << "ERROR: multiply() and the triple loop disagree" << endl;
+		ok = false;
+	}
+
+	if (!benchmark_parallel(engine))
+	{
+		cout << "ERROR: parallel results differ between thread counts" << endl;
+		ok = false;
+	}
+
+	if (!benchmark_vector_math(engine))
+	{
+		cout << "ERROR: batch vector math and plain loops disagree" << endl;
+		ok = false;
+	}
+
+	if (!benchmark_fraction())
+	{
+		cout << "ERROR: Fraction accumulations are not exact" << endl;
+		ok = false;
+	}
+
+	if (!benchmark_chunked_table(engine))
+	{
+		cout << "ERROR: the mapped ChunkedTable differs from the saved one" << endl;
+		ok = false;
+	}
+
+	const size_t point_count = 4000000u;
+	cout << endl << point_count << " points, ms per call" << endl;
+	cout << setw(16) << "type" << setw(10) << "trivial" << setw(14) << "trivial copy"
+	     << setw(14) << "resize" << setw(14) << "allocate" << setw(14) << "copy" << endl;
+
+	bool points_ok = benchmark_points<LegacyPoint2f>("LegacyPoint2f", point_count, engine);
+	points_ok = benchmark_points<Point2f>("Point2f", point_count, engine) && points_ok;
+
+	if (!points_ok)
+	{
+		cout << "ERROR: resized or copied points are wrong" << endl;
+		ok = false;
+	}
+
+	return ok ? 0 : 1;
+}
\ No newline at end of file